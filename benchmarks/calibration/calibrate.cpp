@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * This program measures, for a given type of elements and a
+ * given comparison, the sizes under which the hybrid sorting
+ * algorithms of the library should switch to their simpler
+ * fallback, and writes the results to a header that can be
+ * passed to the library through CPPSORT_THRESHOLDS_PROFILE.
+ * The type and comparison are chosen below, but the library
+ * uses the generated thresholds for every type and comparison:
+ *
+ *     ./calibrate thresholds.h
+ *     g++ -DCPPSORT_THRESHOLDS_PROFILE='"thresholds.h"' ...
+ *
+ * Each threshold is the smallest size for which the cost of
+ * one more step of the main algorithm followed by the fallback
+ * on the resulting halves becomes smaller than the cost of the
+ * fallback on the whole collection. The median of many runs is
+ * used to reduce the noise of the measurements.
+ *
+ * When the random-access sorters use sorting networks as their
+ * base case, the biggest size for which a sorting network is
+ * faster than insertion sort is measured first, and the other
+ * thresholds are measured with that base case.
+ */
+#include <algorithm>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <fstream>
+#include <forward_list>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <ostream>
+#include <utility>
+#include <vector>
+#include <cpp-sort/adapters/small_collection_adapter.h>
+#include <cpp-sort/detail/bubble_sort.h>
+#include <cpp-sort/detail/insertion_sort.h>
+#include <cpp-sort/detail/iter_sort3.h>
+#include <cpp-sort/detail/network_small_sort.h>
+#include <cpp-sort/detail/pdqsort.h>
+#include <cpp-sort/detail/ska_sort.h>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorters/insertion_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../benchmarking-tools/distributions.h"
+#include "../benchmarking-tools/rdtsc.h"
+
+// Type of data to sort during the calibration
+using value_t = int;
+constexpr const char* value_name = "int";
+// Comparison function used during the calibration
+using compare_t = std::less<>;
+constexpr const char* compare_name = "std::less<>";
+
+// Number of runs per size, the median of the runs is kept
+constexpr std::size_t runs_per_size = 301;
+
+// Biggest size that can be sorted with a sorting network
+constexpr std::ptrdiff_t max_network_size = 64;
+
+// Whether the random-access sorters of the library use sorting
+// networks as a base case for the calibrated type and comparison
+constexpr bool use_networks = cppsort::detail::use_network_small_sort<
+    std::vector<value_t>::iterator, compare_t, cppsort::utility::identity
+>::value;
+
+// Poor seed, yet enough for our calibration
+std::uint_fast32_t seed = std::time(nullptr);
+
+////////////////////////////////////////////////////////////
+// Timing functions
+
+template<typename Collection, typename Function>
+auto median_cycles(std::ptrdiff_t size, Function function)
+    -> std::uint64_t
+{
+    // Sort the same collections for every function
+    distributions_prng.seed(seed);
+
+    std::vector<std::uint64_t> cycles;
+    cycles.reserve(runs_per_size);
+    for (std::size_t run = 0 ; run < runs_per_size ; ++run) {
+        std::vector<value_t> values;
+        dist::shuffled{}(std::back_inserter(values), size);
+        Collection collection(values.begin(), values.end());
+
+        std::uint64_t start = rdtsc();
+        function(collection.begin(), collection.end(), size);
+        std::uint64_t end = rdtsc();
+        cycles.push_back(end - start);
+    }
+
+    auto median = cycles.begin() + cycles.size() / 2;
+    std::nth_element(cycles.begin(), median, cycles.end());
+    return *median;
+}
+
+// Smallest size in [min_size, max_size] for which split is
+// faster than fallback, max_size if there is no such size
+template<typename Collection, typename Fallback, typename Split>
+auto find_crossover(std::ptrdiff_t min_size, std::ptrdiff_t max_size, std::ptrdiff_t step,
+                    Fallback fallback, Split split)
+    -> std::ptrdiff_t
+{
+    for (auto size = min_size ; size < max_size ; size += step) {
+        if (median_cycles<Collection>(size, split) < median_cycles<Collection>(size, fallback)) {
+            return size;
+        }
+    }
+    return max_size;
+}
+
+////////////////////////////////////////////////////////////
+// Fallback algorithms and single steps of the main algorithms
+
+auto insertion_sort = [](auto first, auto last, std::ptrdiff_t) {
+    cppsort::detail::insertion_sort(first, last, compare_t{}, cppsort::utility::identity{});
+};
+
+auto bubble_sort = [](auto first, auto, std::ptrdiff_t size) {
+    cppsort::detail::bubble_sort(first, size, compare_t{}, cppsort::utility::identity{});
+};
+
+auto network_sort = [](auto first, auto last, std::ptrdiff_t) {
+    using sorter = cppsort::small_collection_adapter<
+        cppsort::sorting_network_sorter,
+        cppsort::insertion_sorter,
+        std::make_index_sequence<max_network_size + 1>
+    >;
+    sorter{}(first, last, compare_t{});
+};
+
+// Base case of the random-access sorters: sorting networks up to
+// the given size when they are used, then insertion sort
+auto small_sort(std::ptrdiff_t network_threshold)
+{
+    return [=](auto first, auto last, std::ptrdiff_t size) {
+        if (size <= network_threshold) {
+            network_sort(first, last, size);
+        } else {
+            insertion_sort(first, last, size);
+        }
+    };
+}
+
+// Partition around the median of three elements, then call the
+// fallback on both partitions
+template<typename Fallback>
+auto partition_step(Fallback fallback)
+{
+    return [=](auto first, auto last, std::ptrdiff_t size) {
+        compare_t compare;
+        const value_t& a = *first;
+        const value_t& b = *std::next(first, size / 2);
+        const value_t& c = *std::next(first, size - 1);
+        value_t pivot = std::max(std::min(a, b, compare),
+                                 std::min(std::max(a, b, compare), c, compare),
+                                 compare);
+
+        auto middle = std::partition(first, last, [&](const value_t& value) {
+            return compare(value, pivot);
+        });
+        auto left_size = std::distance(first, middle);
+        fallback(first, middle, left_size);
+        fallback(middle, last, size - left_size);
+    };
+}
+
+// Partition like pdqsort does for a leftmost partition of at
+// most CPPSORT_PDQSORT_NINTHER_THRESHOLD elements, then sort
+// both partitions with the base case of pdqsort: the elements
+// of the right partition are never smaller than the pivot, so
+// that partition uses unguarded insertion sort
+auto pdq_partition_step(std::ptrdiff_t network_threshold)
+{
+    return [=](auto first, auto last, std::ptrdiff_t size) {
+        using namespace cppsort::detail;
+        constexpr bool is_branchless =
+            cppsort::utility::is_probably_branchless_comparison_v<compare_t, value_t>;
+
+        compare_t compare;
+        cppsort::utility::identity projection;
+        iter_sort3(first + size / 2, first, last - 1, compare, projection);
+        auto pivot_pos = is_branchless ?
+            pdqsort_detail::partition_right_branchless(first, last, compare, projection).first :
+            pdqsort_detail::partition_right(first, last, compare, projection).first;
+
+        auto left_size = pivot_pos - first;
+        auto right_size = size - left_size - 1;
+        small_sort(network_threshold)(first, pivot_pos, left_size);
+        if (right_size <= network_threshold) {
+            network_sort(pivot_pos + 1, last, right_size);
+        } else {
+            pdqsort_detail::unguarded_insertion_sort(pivot_pos + 1, last, compare, projection);
+        }
+    };
+}
+
+// Call the fallback on both halves, then merge them with the
+// help of a buffer
+template<typename Fallback>
+auto merge_step(Fallback fallback)
+{
+    return [=](auto first, auto last, std::ptrdiff_t size) {
+        auto middle = std::next(first, size / 2);
+        fallback(first, middle, size / 2);
+        fallback(middle, last, size - size / 2);
+
+        std::vector<value_t> buffer(first, middle);
+        std::merge(buffer.begin(), buffer.end(), middle, last, first, compare_t{});
+    };
+}
+
+// Distribute the elements in place into 256 buckets according
+// to the most significant byte of their radix key like the first
+// pass of ska_sort, then call the fallback on every bucket
+template<typename Fallback>
+auto radix_step(Fallback fallback)
+{
+    return [=](auto first, auto last, std::ptrdiff_t) {
+        auto bucket = [](const value_t& value) {
+            constexpr auto shift = (sizeof(value_t) - 1) * CHAR_BIT;
+            return static_cast<std::uint8_t>(cppsort::detail::to_unsigned_or_bool(value) >> shift);
+        };
+
+        std::ptrdiff_t next[256] = {};
+        for (auto it = first ; it != last ; ++it) {
+            ++next[bucket(*it)];
+        }
+        std::ptrdiff_t ends[256];
+        std::ptrdiff_t offset = 0;
+        for (int i = 0 ; i < 256 ; ++i) {
+            offset += next[i];
+            ends[i] = offset;
+            next[i] = offset - next[i];
+        }
+
+        // Swap every element to the next free slot of its bucket
+        for (int i = 0 ; i < 256 ; ++i) {
+            while (next[i] < ends[i]) {
+                auto& value = first[next[i]];
+                int target = bucket(value);
+                if (target == i) {
+                    ++next[i];
+                } else {
+                    std::swap(value, first[next[target]++]);
+                }
+            }
+        }
+
+        std::ptrdiff_t begin = 0;
+        for (int i = 0 ; i < 256 ; ++i) {
+            if (ends[i] - begin > 1) {
+                fallback(first + begin, first + ends[i], ends[i] - begin);
+            }
+            begin = ends[i];
+        }
+    };
+}
+
+auto pdq_sort = [](auto first, auto last, std::ptrdiff_t) {
+    cppsort::pdq_sort(first, last, compare_t{});
+};
+
+////////////////////////////////////////////////////////////
+// Profile generation
+
+auto write_threshold(std::ostream& stream, const char* name, std::ptrdiff_t value)
+    -> void
+{
+    // Don't override the thresholds defined explicitly
+    stream << "#ifndef " << name << '\n'
+           << "#   define " << name << ' ' << value << '\n'
+           << "#endif\n";
+}
+
+int main(int argc, char* argv[])
+{
+    using vector_t = std::vector<value_t>;
+    using forward_list_t = std::forward_list<value_t>;
+
+    std::cerr << "SEED: " << seed << '\n';
+
+    // Sorting networks are tried before any other threshold, so the
+    // insertion sort thresholds are measured above the network one
+    // with a base case that includes the sorting networks
+    std::ptrdiff_t network_threshold = 0;
+    if (use_networks) {
+        network_threshold = find_crossover<vector_t>(8, max_network_size + 1, 1,
+                                                     network_sort, insertion_sort) - 1;
+    }
+    auto small_min_size = std::max<std::ptrdiff_t>(8, network_threshold + 1);
+
+    // Forward iterators are only handled by bubble sort, hence the
+    // use of std::forward_list to calibrate the related thresholds
+    auto quicksort_bubble = find_crossover<forward_list_t>(4, 64, 1, bubble_sort, partition_step(bubble_sort));
+    auto quicksort_insertion = find_crossover<vector_t>(small_min_size, 128, 2, small_sort(network_threshold),
+                                                        partition_step(small_sort(network_threshold)));
+    auto pdqsort_insertion = find_crossover<vector_t>(small_min_size, 128, 2, small_sort(network_threshold),
+                                                      pdq_partition_step(network_threshold));
+    auto merge_sort_bubble = find_crossover<forward_list_t>(4, 64, 1, bubble_sort, merge_step(bubble_sort));
+    auto merge_sort_insertion = find_crossover<vector_t>(small_min_size, 128, 2, small_sort(network_threshold),
+                                                         merge_step(small_sort(network_threshold)));
+    // Measure a single radix pass instead of calling ska_sort, which
+    // would itself fall back to pdqsort under the current threshold
+    auto ska_sort_pdqsort = find_crossover<vector_t>(16, 4096, 16, pdq_sort, radix_step(pdq_sort));
+
+    std::ofstream file;
+    if (argc > 1) {
+        file.open(argv[1]);
+    }
+    std::ostream& output = argc > 1 ? file : std::cout;
+
+    output << "// Generated by benchmarks/calibration/calibrate.cpp\n"
+           << "// Measured with " << value_name << " and " << compare_name
+           << ", used for every type and comparison\n";
+    write_threshold(output, "CPPSORT_PDQSORT_INSERTION_SORT_THRESHOLD", pdqsort_insertion);
+    write_threshold(output, "CPPSORT_QUICKSORT_BUBBLE_SORT_THRESHOLD", quicksort_bubble);
+    write_threshold(output, "CPPSORT_QUICKSORT_INSERTION_SORT_THRESHOLD", quicksort_insertion);
+    write_threshold(output, "CPPSORT_MERGE_SORT_BUBBLE_SORT_THRESHOLD", merge_sort_bubble);
+    write_threshold(output, "CPPSORT_MERGE_SORT_INSERTION_SORT_THRESHOLD", merge_sort_insertion);
+    write_threshold(output, "CPPSORT_SKA_SORT_PDQSORT_THRESHOLD", ska_sort_pdqsort);
+    if (use_networks) {
+        write_threshold(output, "CPPSORT_SORTING_NETWORK_THRESHOLD", network_threshold);
+    }
+}
@@ -10,6 +10,9 @@ macro(cppsort_add_warnings target)
             -Wall -Wextra -Wcast-align -Winline -Wmissing-declarations -Wmissing-include-dirs
             -Wnon-virtual-dtor -Wodr -Wpedantic -Wredundant-decls -Wundef -Wunreachable-code
             $<$<CXX_COMPILER_ID:GNU>:-Wlogical-op -Wuseless-cast -Wzero-as-null-pointer-constant>
+            # The algorithms are constexpr, hence implicitly inline, in C++20, and GCC
+            # reports every inlining it declines with -Og
+            $<$<AND:$<CXX_COMPILER_ID:GNU>,$<CONFIG:Debug>,$<VERSION_GREATER_EQUAL:$<TARGET_PROPERTY:${target},CXX_STANDARD>,20>>:-Wno-inline>
             # The warning when initializing an std::array is just too much of a bother
             $<$<CXX_COMPILER_ID:Clang>:-Wno-missing-braces>
         )
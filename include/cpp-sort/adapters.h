@@ -10,12 +10,15 @@
 ////////////////////////////////////////////////////////////
 #include <cpp-sort/adapters/container_aware_adapter.h>
 #include <cpp-sort/adapters/counting_adapter.h>
+#include <cpp-sort/adapters/external_adapter.h>
 #include <cpp-sort/adapters/hybrid_adapter.h>
 #include <cpp-sort/adapters/indirect_adapter.h>
 #include <cpp-sort/adapters/out_of_place_adapter.h>
 #include <cpp-sort/adapters/schwartz_adapter.h>
 #include <cpp-sort/adapters/self_sort_adapter.h>
 #include <cpp-sort/adapters/small_array_adapter.h>
+#include <cpp-sort/adapters/small_collection_adapter.h>
+#include <cpp-sort/adapters/sorted_prefix_adapter.h>
 #include <cpp-sort/adapters/stable_adapter.h>
 #include <cpp-sort/adapters/verge_adapter.h>
 
@@ -369,10 +369,18 @@ namespace cppsort
 #include "../detail/container_aware/merge_sort.h"
 #endif
 
+#ifdef CPPSORT_SORTERS_PDQ_SORTER_DONE_
+#include "../detail/container_aware/pdq_sort.h"
+#endif
+
 #ifdef CPPSORT_SORTERS_SELECTION_SORTER_DONE_
 #include "../detail/container_aware/selection_sort.h"
 #endif
 
+#ifdef CPPSORT_SORTERS_SKA_SORTER_DONE_
+#include "../detail/container_aware/ska_sort.h"
+#endif
+
 #define CPPSORT_ADAPTERS_CONTAINER_AWARE_ADAPTER_DONE_
 
 #endif // CPPSORT_ADAPTERS_CONTAINER_AWARE_ADAPTER_H_
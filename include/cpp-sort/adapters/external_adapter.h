@@ -0,0 +1,384 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_EXTERNAL_ADAPTER_H_
+#define CPPSORT_ADAPTERS_EXTERNAL_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/checkers.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/loser_tree.h"
+#include "../detail/memory.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Adapter
+
+    namespace detail
+    {
+        // Memory used by default to sort runs and buffer I/O
+        constexpr std::size_t external_default_memory_size = 64u * 1024u * 1024u;
+
+        // Minimal size of the buffer of each run during the merge
+        // phase, under which runs are merged in several passes
+        constexpr std::size_t external_min_block_size = 64u * 1024u;
+
+        ////////////////////////////////////////////////////////////
+        // Temporary files
+
+        struct file_closer
+        {
+            auto operator()(std::FILE* file) const noexcept
+                -> void
+            {
+                std::fclose(file);
+            }
+        };
+
+        using unique_file = std::unique_ptr<std::FILE, file_closer>;
+
+        inline auto make_temporary_file()
+            -> unique_file
+        {
+            unique_file file(std::tmpfile());
+            if (not file) {
+                throw std::runtime_error("external_adapter: could not create a temporary file");
+            }
+            return file;
+        }
+
+        template<typename T>
+        auto write_records(std::FILE* file, const T* data, std::size_t count)
+            -> void
+        {
+            if (std::fwrite(data, sizeof(T), count, file) != count) {
+                throw std::runtime_error("external_adapter: could not write to a temporary file");
+            }
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Sequential reader over a run stored in a file, reading
+        // big blocks of records at once
+
+        template<typename T>
+        class run_reader
+        {
+            public:
+
+                run_reader(std::FILE* file, T* buffer, std::size_t buffer_size):
+                    file_(file),
+                    buffer_(buffer),
+                    buffer_size_(buffer_size)
+                {
+                    std::rewind(file_);
+                    refill();
+                }
+
+                auto empty() const noexcept
+                    -> bool
+                {
+                    return pos_ == count_;
+                }
+
+                auto front() const noexcept
+                    -> T&
+                {
+                    return buffer_[pos_];
+                }
+
+                auto pop()
+                    -> void
+                {
+                    if (++pos_ == count_) {
+                        refill();
+                    }
+                }
+
+            private:
+
+                auto refill()
+                    -> void
+                {
+                    pos_ = 0;
+                    count_ = std::fread(buffer_, sizeof(T), buffer_size_, file_);
+                    if (count_ == 0 && std::ferror(file_)) {
+                        throw std::runtime_error("external_adapter: could not read a temporary file");
+                    }
+                }
+
+                std::FILE* file_;
+                T* buffer_;
+                std::size_t buffer_size_;
+                std::size_t pos_ = 0;
+                std::size_t count_ = 0;
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Merge runs stored in files
+
+        template<typename T, typename OutputFunction, typename Compare, typename Projection>
+        auto merge_run_files(unique_file* files, std::size_t nb_files,
+                             T* buffer, std::size_t block_size,
+                             OutputFunction output,
+                             Compare compare, Projection projection)
+            -> void
+        {
+            std::vector<run_reader<T>> readers;
+            readers.reserve(nb_files);
+            for (std::size_t i = 0 ; i < nb_files ; ++i) {
+                readers.emplace_back(files[i].get(), buffer + i * block_size, block_size);
+            }
+
+            loser_tree<run_reader<T>, Compare, Projection> tree(
+                readers.data(), readers.size(),
+                std::move(compare), std::move(projection)
+            );
+            while (not tree.empty()) {
+                output(tree.top().front());
+                tree.pop();
+            }
+        }
+
+        template<typename T, typename Compare, typename Projection>
+        auto merge_run_files_to_file(unique_file* files, std::size_t nb_files,
+                                     T* buffer, std::size_t block_size,
+                                     Compare compare, Projection projection)
+            -> unique_file
+        {
+            // The last block of the buffer is used for the output
+            auto file = make_temporary_file();
+            T* out_buffer = buffer + nb_files * block_size;
+            std::size_t out_size = 0;
+
+            merge_run_files(files, nb_files, buffer, block_size, [&](const T& value) {
+                out_buffer[out_size] = value;
+                if (++out_size == block_size) {
+                    write_records(file.get(), out_buffer, out_size);
+                    out_size = 0;
+                }
+            }, std::move(compare), std::move(projection));
+            write_records(file.get(), out_buffer, out_size);
+
+            return file;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Sort collections that fit in memory: in place when the
+        // sorter accepts the iterators of the collection, otherwise
+        // in a buffer like out_of_place_adapter
+
+        template<typename Sorter, typename ForwardIterator, typename Compare, typename Projection>
+        auto sort_in_memory(std::true_type, const Sorter& sorter,
+                            ForwardIterator first, ForwardIterator last, std::size_t,
+                            Compare compare, Projection projection)
+            -> void
+        {
+            sorter(std::move(first), std::move(last), std::move(compare), std::move(projection));
+        }
+
+        template<typename Sorter, typename ForwardIterator, typename Compare, typename Projection>
+        auto sort_in_memory(std::false_type, const Sorter& sorter,
+                            ForwardIterator first, ForwardIterator last, std::size_t size,
+                            Compare compare, Projection projection)
+            -> void
+        {
+            sort_out_of_place(std::move(first), std::move(last), size, sorter,
+                              std::move(compare), std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // External merge sort
+
+        template<typename Sorter, typename ForwardIterator, typename Compare, typename Projection>
+        auto external_sort(const Sorter& sorter,
+                           ForwardIterator first, ForwardIterator last,
+                           std::size_t memory_size,
+                           Compare compare, Projection projection)
+            -> void
+        {
+            using value_type = value_type_t<ForwardIterator>;
+            static_assert(
+                std::is_trivially_copyable<value_type>::value &&
+                alignof(value_type) <= alignof(std::max_align_t),
+                "external_adapter can only sort trivially copyable types without extended alignment"
+            );
+
+            if (first == last) return;
+
+            std::size_t buffer_size = memory_size / sizeof(value_type);
+            if (buffer_size < 8) {
+                // Ensure that every merge gets blocks of at least two
+                // elements, even with absurdly low memory sizes
+                buffer_size = 8;
+            }
+
+            auto size = static_cast<std::size_t>(std::distance(first, last));
+            if (size <= buffer_size) {
+                // Everything fits in memory, no need for runs and files
+                using can_sort_in_place = std::is_base_of<
+                    iterator_category<Sorter>,
+                    iterator_category_t<ForwardIterator>
+                >;
+                sort_in_memory(can_sort_in_place{}, sorter, std::move(first), std::move(last), size,
+                               std::move(compare), std::move(projection));
+                return;
+            }
+
+            // The buffer is too big to be kept alive between sorts
+            // like the thread scratch memory of out_of_place_adapter
+            std::unique_ptr<value_type, operator_deleter> buffer(
+                static_cast<value_type*>(::operator new(buffer_size * sizeof(value_type))),
+                operator_deleter(buffer_size * sizeof(value_type))
+            );
+            value_type* buff = buffer.get();
+
+            ////////////////////////////////////////////////////////////
+            // Sort runs that fit in memory and spill them to files
+
+            std::vector<unique_file> runs;
+            auto it = first;
+            while (it != last) {
+                value_type* out = buff;
+                while (it != last && out != buff + buffer_size) {
+                    *out = *it;
+                    ++out;
+                    ++it;
+                }
+                sorter(buff, out, compare, projection);
+                runs.push_back(make_temporary_file());
+                write_records(runs.back().get(), buff, static_cast<std::size_t>(out - buff));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Merge groups of runs until few enough remain to give
+            // each of them a block big enough for efficient I/O
+
+            std::size_t min_block = external_min_block_size / sizeof(value_type);
+            if (min_block == 0) {
+                min_block = 1;
+            }
+            std::size_t max_fan_in = buffer_size / min_block;
+            if (max_fan_in < 3) {
+                max_fan_in = 3;
+            }
+
+            while (runs.size() > max_fan_in) {
+                // Keep a block for the output of each intermediate merge
+                std::size_t fan_in = max_fan_in - 1;
+                std::size_t block_size = buffer_size / (fan_in + 1);
+
+                std::vector<unique_file> merged_runs;
+                for (std::size_t i = 0 ; i < runs.size() ; i += fan_in) {
+                    auto nb_files = (std::min)(fan_in, runs.size() - i);
+                    if (nb_files == 1) {
+                        merged_runs.push_back(std::move(runs[i]));
+                        continue;
+                    }
+                    merged_runs.push_back(merge_run_files_to_file(
+                        runs.data() + i, nb_files, buff, block_size,
+                        compare, projection
+                    ));
+                }
+                runs = std::move(merged_runs);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Final merge, directly into the original collection: if
+            // it throws, the beginning of the collection has already
+            // been overwritten and some elements are lost
+
+            merge_run_files(runs.data(), runs.size(), buff, buffer_size / runs.size(),
+                            [&first](const value_type& value) {
+                                *first = value;
+                                ++first;
+                            },
+                            std::move(compare), std::move(projection));
+        }
+
+        template<typename Sorter>
+        struct external_adapter_impl:
+            utility::adapter_storage<Sorter>,
+            check_is_always_stable<Sorter>
+        {
+            std::size_t memory_size = external_default_memory_size;
+
+            external_adapter_impl() = default;
+
+            constexpr explicit external_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            constexpr external_adapter_impl(Sorter&& sorter, std::size_t size):
+                utility::adapter_storage<Sorter>(std::move(sorter)),
+                memory_size(size)
+            {}
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                external_sort(this->get(), std::move(first), std::move(last), memory_size,
+                              std::move(compare), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::forward_iterator_tag;
+        };
+    }
+
+    template<typename Sorter>
+    struct external_adapter:
+        sorter_facade<detail::external_adapter_impl<Sorter>>
+    {
+        external_adapter() = default;
+
+        constexpr explicit external_adapter(Sorter sorter):
+            sorter_facade<detail::external_adapter_impl<Sorter>>(std::move(sorter))
+        {}
+
+        constexpr external_adapter(Sorter sorter, std::size_t memory_size):
+            sorter_facade<detail::external_adapter_impl<Sorter>>(std::move(sorter), memory_size)
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // is_stable specialization
+
+    template<typename Sorter, typename... Args>
+    struct is_stable<external_adapter<Sorter>(Args...)>:
+        is_stable<Sorter(Args...)>
+    {};
+}
+
+#endif // CPPSORT_ADAPTERS_EXTERNAL_ADAPTER_H_
@@ -12,19 +12,16 @@
 #include <iterator>
 #include <type_traits>
 #include <utility>
-#include <vector>
 #include <cpp-sort/sorter_facade.h>
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/adapter_storage.h>
 #include <cpp-sort/utility/functional.h>
-#include <cpp-sort/utility/iter_move.h>
 #include <cpp-sort/utility/size.h>
 #include "../detail/checkers.h"
 #include "../detail/functional.h"
-#include "../detail/immovable_vector.h"
+#include "../detail/index_sort.h"
 #include "../detail/indiesort.h"
 #include "../detail/iterator_traits.h"
-#include "../detail/scope_exit.h"
 #include "../detail/type_traits.h"
 
 namespace cppsort
@@ -53,72 +50,10 @@ namespace cppsort
                              Compare compare, Projection projection)
             -> decltype(auto)
         {
-            using utility::iter_move;
-
-            ////////////////////////////////////////////////////////////
-            // Indirectly sort the iterators
-
-            immovable_vector<RandomAccessIterator> iterators(size);
-            for (auto it = first; it != last; ++it) {
-                iterators.emplace_back(it);
-            }
-
-#ifndef __cpp_lib_uncaught_exceptions
-            // Sort the iterators on pointed values
-            std::forward<Sorter>(sorter)(
-                iterators.begin(), iterators.end(),
-                std::move(compare), indirect(projection)
-            );
-#else
-            // Work around the sorters that return void
-            auto exit_function = make_scope_success([&] {
-#endif
-                ////////////////////////////////////////////////////////////
-                // Move the values according the iterator's positions
-
-                std::vector<bool> sorted(last - first, false);
-
-                // Element where the current cycle starts
-                auto start = first;
-
-                while (start != last) {
-                    // Find the element to put in current's place
-                    auto current = start;
-                    auto next_pos = current - first;
-                    auto next = iterators[next_pos];
-                    sorted[next_pos] = true;
-
-                    // Process the current cycle
-                    if (next != current) {
-                        auto tmp = iter_move(current);
-                        while (next != start) {
-                            *current = iter_move(next);
-                            current = next;
-                            auto next_pos = next - first;
-                            next = iterators[next_pos];
-                            sorted[next_pos] = true;
-                        }
-                        *current = std::move(tmp);
-                    }
-
-                    // Find the next cycle
-                    do {
-                        ++start;
-                    } while (start != last && sorted[start - first]);
-
-                }
-#ifdef __cpp_lib_uncaught_exceptions
-            });
-
-            if (size < 2) {
-                exit_function.deactivate();
-            }
-
-            return std::forward<Sorter>(sorter)(
-                iterators.begin(), iterators.end(),
-                std::move(compare), indirect(projection)
-            );
-#endif
+            // Sort the indices of the elements on pointed values,
+            // then move the values according to their positions
+            return sort_with_indices(std::forward<Sorter>(sorter), first, last, size,
+                                     std::move(compare), indexed(first, std::move(projection)));
         }
 
         template<typename Sorter>
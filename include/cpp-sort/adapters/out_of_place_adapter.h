@@ -20,6 +20,7 @@
 #include "../detail/checkers.h"
 #include "../detail/immovable_vector.h"
 #include "../detail/iterator_traits.h"
+#include "../detail/scratch_buffer.h"
 #include "../detail/scope_exit.h"
 #include "../detail/type_traits.h"
 
@@ -31,7 +32,7 @@ namespace cppsort
     namespace detail
     {
         template<typename Sorter, typename ForwardIterator, typename Size, typename... Args>
-        auto sort_out_of_place(ForwardIterator first, ForwardIterator last,
+        auto sort_out_of_place(std::false_type, ForwardIterator first, ForwardIterator last,
                                Size size, const Sorter& sorter, Args&&... args)
             -> decltype(auto)
         {
@@ -58,6 +59,47 @@ namespace cppsort
             std::move(buffer.begin(), buffer.end(), first);
 #endif
         }
+
+        template<typename Sorter, typename ForwardIterator, typename Size, typename... Args>
+        auto sort_out_of_place(std::true_type, ForwardIterator first, ForwardIterator last,
+                               Size size, const Sorter& sorter, Args&&... args)
+            -> decltype(auto)
+        {
+            using rvalue_type = rvalue_type_t<ForwardIterator>;
+
+            // Trivially copyable elements are copied in bulk to memory
+            // reused between calls: std::copy boils down to memmove for
+            // contiguous iterators, and standard library implementations
+            // commonly turn it into one memmove per segment for deques
+            scratch_buffer<rvalue_type> buffer(size);
+            auto buffer_first = buffer.data();
+            auto buffer_last = std::copy(first, last, buffer_first);
+
+#ifdef __cpp_lib_uncaught_exceptions
+            // Work around the sorters that return void
+            auto exit_function = make_scope_success([&] {
+                // Copy the sorted elements back in the original collection
+                std::copy(buffer_first, buffer_last, first);
+            });
+
+            // Sort the elements in the memory buffer
+            return sorter(buffer_first, buffer_last, std::forward<Args>(args)...);
+#else
+            // Sort the elements in the memory buffer
+            sorter(buffer_first, buffer_last, std::forward<Args>(args)...);
+            // Copy the sorted elements back in the original collection
+            std::copy(buffer_first, buffer_last, first);
+#endif
+        }
+
+        template<typename Sorter, typename ForwardIterator, typename Size, typename... Args>
+        auto sort_out_of_place(ForwardIterator first, ForwardIterator last,
+                               Size size, const Sorter& sorter, Args&&... args)
+            -> decltype(auto)
+        {
+            using scratch_t = can_use_scratch_buffer<rvalue_type_t<ForwardIterator>>;
+            return sort_out_of_place(scratch_t{}, first, last, size, sorter, std::forward<Args>(args)...);
+        }
     }
 
     template<typename Sorter>
@@ -23,7 +23,9 @@
 #include "../detail/associate_iterator.h"
 #include "../detail/checkers.h"
 #include "../detail/config.h"
+#include "../detail/functional.h"
 #include "../detail/immovable_vector.h"
+#include "../detail/index_sort.h"
 #include "../detail/iterator_traits.h"
 #include "../detail/type_traits.h"
 
@@ -62,7 +64,8 @@ namespace cppsort
             typename Projection,
             typename Sorter
         >
-        auto sort_with_schwartz(ForwardIterator first, difference_type_t<ForwardIterator> size,
+        auto sort_with_schwartz(std::forward_iterator_tag,
+                                ForwardIterator first, difference_type_t<ForwardIterator> size,
                                 Compare compare, Projection projection, Sorter&& sorter)
             -> decltype(auto)
         {
@@ -92,6 +95,82 @@ namespace cppsort
             );
         }
 
+        template<
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        auto sort_with_schwartz(std::random_access_iterator_tag,
+                                RandomAccessIterator first, difference_type_t<RandomAccessIterator> size,
+                                Compare compare, Projection projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            auto&& proj = utility::as_function(projection);
+            using proj_t = projected_t<RandomAccessIterator, Projection>;
+            using difference_type = difference_type_t<RandomAccessIterator>;
+
+            // Cache the projected elements in a contiguous array
+            immovable_vector<proj_t> keys(size);
+            auto it = first;
+            for (difference_type count = 0; count != size; ++count) {
+                keys.emplace_back(proj(*it));
+                ++it;
+            }
+
+            // Sort the indices of the elements on the cached projections,
+            // then move the elements of the original sequence accordingly
+            return sort_with_indices(std::forward<Sorter>(sorter), first, it, size,
+                                     std::move(compare), indexed(keys.begin(), utility::identity{}));
+        }
+
+#ifdef __cpp_lib_uncaught_exceptions
+        template<
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        using schwartz_category_t = iterator_category_t<ForwardIterator>;
+#else
+        // Sorting indices requires to move the elements after the call
+        // to the adapted sorter, which means that its result can't be
+        // returned: only sorters returning void can use that method
+        template<
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        using schwartz_category_t = conditional_t<
+            std::is_void<invoke_result_t<
+                Sorter,
+                associate_iterator<association<ForwardIterator, projected_t<ForwardIterator, Projection>>*>,
+                associate_iterator<association<ForwardIterator, projected_t<ForwardIterator, Projection>>*>,
+                Compare,
+                data_getter
+            >>::value,
+            iterator_category_t<ForwardIterator>,
+            std::forward_iterator_tag
+        >;
+#endif
+
+        template<
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        auto sort_with_schwartz(ForwardIterator first, difference_type_t<ForwardIterator> size,
+                                Compare compare, Projection projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            using category = schwartz_category_t<ForwardIterator, Compare, Projection, Sorter>;
+            return sort_with_schwartz(category{}, std::move(first), size,
+                                      std::move(compare), std::move(projection),
+                                      std::forward<Sorter>(sorter));
+        }
+
         ////////////////////////////////////////////////////////////
         // Adapter
 
@@ -19,26 +19,6 @@
 
 namespace cppsort
 {
-    namespace detail
-    {
-        ////////////////////////////////////////////////////////////
-        // SFINAE helpers
-
-        template<typename T, typename=void>
-        struct has_domain:
-            std::false_type
-        {
-            using domain = void;
-        };
-
-        template<typename T>
-        struct has_domain<T, void_t<typename T::domain>>:
-            std::true_type
-        {
-            using domain = typename T::domain;
-        };
-    }
-
     ////////////////////////////////////////////////////////////
     // Adapter
 
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_SMALL_COLLECTION_ADAPTER_H_
+#define CPPSORT_ADAPTERS_SMALL_COLLECTION_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Adapter
+
+    namespace detail
+    {
+        template<std::size_t... Values>
+        constexpr auto max_of_pack() noexcept
+            -> std::size_t
+        {
+            std::size_t arr[] = { 0, Values... };
+            std::size_t res = 0;
+            for (std::size_t val: arr) {
+                if (res < val) {
+                    res = val;
+                }
+            }
+            return res;
+        }
+
+        // Entry of the jump table for a given size, null when the
+        // size is not in the domain of the fixed-size sorter
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            std::size_t N,
+            bool = true
+        >
+        struct fixed_size_entry
+        {
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            static auto sort(RandomAccessIterator first, Compare& compare, Projection& projection)
+                -> void
+            {
+                FixedSizeSorter<N>{}(first, first + N, compare, projection);
+            }
+
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            static constexpr auto get() noexcept
+                -> void(*)(RandomAccessIterator, Compare&, Projection&)
+            {
+                return &sort<RandomAccessIterator, Compare, Projection>;
+            }
+        };
+
+        template<template<std::size_t> class FixedSizeSorter, std::size_t N>
+        struct fixed_size_entry<FixedSizeSorter, N, false>
+        {
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            static constexpr auto get() noexcept
+                -> void(*)(RandomAccessIterator, Compare&, Projection&)
+            {
+                return nullptr;
+            }
+        };
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            typename Sorter,
+            typename Indices
+        >
+        struct small_collection_adapter_impl;
+
+        template<
+            template<std::size_t> class FixedSizeSorter,
+            typename Sorter,
+            std::size_t... Indices
+        >
+        struct small_collection_adapter_impl<FixedSizeSorter, Sorter, std::index_sequence<Indices...>>:
+            utility::adapter_storage<Sorter>
+        {
+            small_collection_adapter_impl() = default;
+
+            constexpr explicit small_collection_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "small_collection_adapter requires at least random-access iterators"
+                );
+
+                using sort_function = void(*)(RandomAccessIterator, Compare&, Projection&);
+                constexpr std::size_t table_size = max_of_pack<Indices...>() + 1;
+
+                auto size = static_cast<std::size_t>(last - first);
+                if (size < table_size) {
+                    auto sort = jump_table<sort_function, RandomAccessIterator, Compare, Projection>(
+                        std::make_index_sequence<table_size>{}
+                    )[size];
+                    if (sort != nullptr) {
+                        sort(first, compare, projection);
+                        return;
+                    }
+                }
+                this->get()(std::move(first), std::move(last),
+                            std::move(compare), std::move(projection));
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::integral_constant<bool,
+                fixed_sorter_traits<FixedSizeSorter>::is_always_stable::value &&
+                cppsort::is_always_stable_v<Sorter>
+            >;
+
+        private:
+
+            // One function per size, indexed by the size of the
+            // collection to sort
+            template<
+                typename SortFunction,
+                typename RandomAccessIterator,
+                typename Compare,
+                typename Projection,
+                std::size_t... Sizes
+            >
+            static auto jump_table(std::index_sequence<Sizes...>)
+                -> const SortFunction*
+            {
+                static constexpr SortFunction table[] = {
+                    fixed_size_entry<
+                        FixedSizeSorter, Sizes, is_in_pack<Sizes, Indices...>
+                    >::template get<RandomAccessIterator, Compare, Projection>()...
+                };
+                return table;
+            }
+        };
+    }
+
+    template<
+        template<std::size_t> class FixedSizeSorter,
+        typename Sorter,
+        typename Indices = typename detail::has_domain<
+            fixed_sorter_traits<FixedSizeSorter>
+        >::domain
+    >
+    struct small_collection_adapter:
+        sorter_facade<detail::small_collection_adapter_impl<FixedSizeSorter, Sorter, Indices>>
+    {
+        static_assert(not std::is_void<Indices>::value,
+                      "small_collection_adapter needs the sizes handled by the fixed-size sorter "
+                      "when it does not provide a domain");
+
+        small_collection_adapter() = default;
+
+        constexpr explicit small_collection_adapter(Sorter sorter):
+            sorter_facade<detail::small_collection_adapter_impl<FixedSizeSorter, Sorter, Indices>>(
+                std::move(sorter)
+            )
+        {}
+    };
+}
+
+#endif // CPPSORT_ADAPTERS_SMALL_COLLECTION_ADAPTER_H_
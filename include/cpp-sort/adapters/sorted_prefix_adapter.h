@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_ADAPTERS_SORTED_PREFIX_ADAPTER_H_
+#define CPPSORT_ADAPTERS_SORTED_PREFIX_ADAPTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/adapter_storage.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/checkers.h"
+#include "../detail/inplace_merge.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+#include "../detail/upper_bound.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Adapter
+
+    namespace detail
+    {
+        template<typename ForwardIterator, typename Compare, typename Projection>
+        auto merge_sorted_tail(ForwardIterator first, ForwardIterator middle, ForwardIterator last,
+                               difference_type_t<ForwardIterator>, difference_type_t<ForwardIterator>,
+                               Compare compare, Projection projection,
+                               std::forward_iterator_tag)
+            -> void
+        {
+            detail::inplace_merge(std::move(first), std::move(middle), std::move(last),
+                                  std::move(compare), std::move(projection));
+        }
+
+        template<typename BidirectionalIterator, typename Compare, typename Projection>
+        auto merge_sorted_tail(BidirectionalIterator first, BidirectionalIterator middle,
+                               BidirectionalIterator last,
+                               difference_type_t<BidirectionalIterator> prefix_size,
+                               difference_type_t<BidirectionalIterator> tail_size,
+                               Compare compare, Projection projection,
+                               std::bidirectional_iterator_tag)
+            -> void
+        {
+            auto&& proj = utility::as_function(projection);
+
+            // Elements of the prefix that are not greater than the
+            // smallest element of the tail are already in place: skip
+            // them with a binary search, the buffer used by the merge
+            // is then only as big as the tail
+            auto new_first = detail::upper_bound_n(first, prefix_size, proj(*middle),
+                                                   compare, projection);
+            if (new_first == middle) return;
+
+            detail::inplace_merge(new_first, std::move(middle), std::move(last),
+                                  std::move(compare), std::move(projection),
+                                  std::distance(new_first, middle), tail_size);
+        }
+
+        template<typename Sorter>
+        struct sorted_prefix_adapter_impl:
+            utility::adapter_storage<Sorter>,
+            check_iterator_category<Sorter>,
+            check_is_always_stable<Sorter>
+        {
+            sorted_prefix_adapter_impl() = default;
+
+            constexpr explicit sorted_prefix_adapter_impl(Sorter&& sorter):
+                utility::adapter_storage<Sorter>(std::move(sorter))
+            {}
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> void
+            {
+                using category = iterator_category_t<ForwardIterator>;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                if (first == last) return;
+
+                // Find the end of the sorted prefix
+                auto current = first;
+                auto middle = std::next(first);
+                difference_type_t<ForwardIterator> prefix_size = 1;
+                while (middle != last && not comp(proj(*middle), proj(*current))) {
+                    ++current;
+                    ++middle;
+                    ++prefix_size;
+                }
+                if (middle == last) return;
+
+                // Sort the unsorted tail with the adapted sorter
+                this->get()(middle, last, compare, projection);
+
+                // Merge the sorted tail into the sorted prefix
+                auto tail_size = std::distance(middle, last);
+                merge_sorted_tail(std::move(first), std::move(middle), std::move(last),
+                                  prefix_size, tail_size,
+                                  std::move(compare), std::move(projection),
+                                  category{});
+            }
+        };
+    }
+
+    template<typename Sorter>
+    struct sorted_prefix_adapter:
+        sorter_facade<detail::sorted_prefix_adapter_impl<Sorter>>
+    {
+        sorted_prefix_adapter() = default;
+
+        constexpr explicit sorted_prefix_adapter(Sorter sorter):
+            sorter_facade<detail::sorted_prefix_adapter_impl<Sorter>>(std::move(sorter))
+        {}
+    };
+
+    ////////////////////////////////////////////////////////////
+    // is_stable specialization
+
+    template<typename Sorter, typename... Args>
+    struct is_stable<sorted_prefix_adapter<Sorter>(Args...)>:
+        is_stable<Sorter(Args...)>
+    {};
+}
+
+#endif // CPPSORT_ADAPTERS_SORTED_PREFIX_ADAPTER_H_
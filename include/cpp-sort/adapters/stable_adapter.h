@@ -8,8 +8,11 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <iterator>
+#include <limits>
 #include <tuple>
 #include <type_traits>
 #include <utility>
@@ -21,7 +24,9 @@
 #include <cpp-sort/utility/size.h>
 #include "../detail/associate_iterator.h"
 #include "../detail/checkers.h"
+#include "../detail/functional.h"
 #include "../detail/immovable_vector.h"
+#include "../detail/index_sort.h"
 #include "../detail/iterator_traits.h"
 #include "../detail/raw_checkers.h"
 #include "../detail/sized_iterator.h"
@@ -76,6 +81,46 @@ namespace cppsort
             return { compare, projection };
         }
 
+        template<typename Compare, typename Projection>
+        class stable_index_compare
+        {
+            private:
+
+                using compare_t = detail::remove_cvref_t<
+                    decltype(utility::as_function(std::declval<Compare>()))
+                >;
+                std::tuple<compare_t, Projection> data;
+
+            public:
+
+                stable_index_compare(Compare compare, Projection projection):
+                    data(utility::as_function(compare), std::move(projection))
+                {}
+
+                template<typename Index>
+                auto operator()(Index lhs, Index rhs)
+                    -> bool
+                {
+                    // Projection maps an index to the projected element
+                    if (std::get<0>(data)(std::get<1>(data)(lhs),
+                                          std::get<1>(data)(rhs))) {
+                        return true;
+                    }
+                    if (std::get<0>(data)(std::get<1>(data)(rhs),
+                                          std::get<1>(data)(lhs))) {
+                        return false;
+                    }
+                    return lhs < rhs;
+                }
+        };
+
+        template<typename Compare, typename RandomAccessIterator, typename Projection>
+        auto make_stable_index_compare(Compare compare, RandomAccessIterator first, Projection projection)
+            -> stable_index_compare<Compare, indexed_t<RandomAccessIterator, Projection>>
+        {
+            return { compare, indexed(first, projection) };
+        }
+
         ////////////////////////////////////////////////////////////
         // make_stable_and_sort
 
@@ -85,7 +130,8 @@ namespace cppsort
             typename Projection,
             typename Sorter
         >
-        auto make_stable_and_sort(ForwardIterator first, difference_type_t<ForwardIterator> size,
+        auto make_stable_and_sort(std::forward_iterator_tag,
+                                  ForwardIterator first, difference_type_t<ForwardIterator> size,
                                   Compare&& compare, Projection&& projection, Sorter&& sorter)
             -> decltype(auto)
         {
@@ -115,6 +161,166 @@ namespace cppsort
             );
         }
 
+        template<typename Sorter>
+        using packed_sort_result_t = invoke_result_t<Sorter, std::uint64_t*, std::uint64_t*>;
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter,
+            typename Key = projected_t<RandomAccessIterator, Projection>
+        >
+        struct can_pack_stable_keys:
+            conjunction<
+                is_integral<Key>,
+                std::integral_constant<bool, sizeof(Key) <= sizeof(std::uint32_t)>,
+                disjunction<
+                    is_natural_less<remove_cvref_t<Compare>, Key>,
+                    is_natural_greater<remove_cvref_t<Compare>, Key>
+                >,
+                // Both ways to sort must have the same result type
+                std::is_same<
+                    detected_t<packed_sort_result_t, Sorter>,
+                    invoke_result_t<
+                        Sorter, std::size_t*, std::size_t*,
+                        stable_index_compare<
+                            remove_cvref_t<Compare>,
+                            indexed_t<RandomAccessIterator, remove_cvref_t<Projection>>
+                        >
+                    >
+                >
+            >
+        {};
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        auto make_stable_and_sort_indices(std::false_type,
+                                          RandomAccessIterator first, difference_type_t<RandomAccessIterator> size,
+                                          Compare&& compare, Projection&& projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            ////////////////////////////////////////////////////////////
+            // Sort the indices of the elements, using the indices
+            // themselves to break ties, then move the elements
+
+            return sort_with_indices(
+                std::forward<Sorter>(sorter), first, first + size, size,
+                make_stable_index_compare(
+                    std::forward<Compare>(compare), first,
+                    std::forward<Projection>(projection)
+                )
+            );
+        }
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        auto make_stable_and_sort_indices(std::true_type,
+                                          RandomAccessIterator first, difference_type_t<RandomAccessIterator> size,
+                                          Compare&& compare, Projection&& projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            using key_t = projected_t<RandomAccessIterator, Projection>;
+            constexpr bool descending = is_natural_greater<remove_cvref_t<Compare>, key_t>::value;
+
+            if (static_cast<std::uintmax_t>(size) > std::numeric_limits<std::uint32_t>::max()) {
+                // Indices don't fit in the low half of the packed values
+                return make_stable_and_sort_indices(
+                    std::false_type{}, first, size,
+                    std::forward<Compare>(compare),
+                    std::forward<Projection>(projection),
+                    std::forward<Sorter>(sorter)
+                );
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Pack small integer keys and indices together, then
+            // sort the packed values with their natural order
+
+            return sort_with_packed_indices<descending>(
+                std::forward<Sorter>(sorter), first, first + size, size,
+                std::forward<Projection>(projection)
+            );
+        }
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        auto make_stable_and_sort(std::random_access_iterator_tag,
+                                  RandomAccessIterator first, difference_type_t<RandomAccessIterator> size,
+                                  Compare&& compare, Projection&& projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            using can_pack = can_pack_stable_keys<RandomAccessIterator, Compare, Projection, Sorter>;
+            return make_stable_and_sort_indices(
+                can_pack{}, first, size,
+                std::forward<Compare>(compare),
+                std::forward<Projection>(projection),
+                std::forward<Sorter>(sorter)
+            );
+        }
+
+#ifdef __cpp_lib_uncaught_exceptions
+        template<
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        using make_stable_category_t = iterator_category_t<ForwardIterator>;
+#else
+        // Sorting indices requires to move the elements after the call
+        // to the adapted sorter, which means that its result can't be
+        // returned: only sorters returning void can use that method
+        template<
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        using make_stable_category_t = conditional_t<
+            std::is_void<invoke_result_t<
+                Sorter,
+                associate_iterator<association<ForwardIterator, difference_type_t<ForwardIterator>>*>,
+                associate_iterator<association<ForwardIterator, difference_type_t<ForwardIterator>>*>,
+                stable_compare<remove_cvref_t<Compare>, remove_cvref_t<Projection>>
+            >>::value,
+            iterator_category_t<ForwardIterator>,
+            std::forward_iterator_tag
+        >;
+#endif
+
+        template<
+            typename ForwardIterator,
+            typename Compare,
+            typename Projection,
+            typename Sorter
+        >
+        auto make_stable_and_sort(ForwardIterator first, difference_type_t<ForwardIterator> size,
+                                  Compare&& compare, Projection&& projection, Sorter&& sorter)
+            -> decltype(auto)
+        {
+            using category = make_stable_category_t<ForwardIterator, Compare, Projection, Sorter>;
+            return make_stable_and_sort(
+                category{},
+                std::move(first), size,
+                std::forward<Compare>(compare),
+                std::forward<Projection>(projection),
+                std::forward<Sorter>(sorter)
+            );
+        }
+
         template<
             typename ForwardIterator,
             typename Compare,
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_APPLY_PERMUTATION_H_
+#define CPPSORT_DETAIL_APPLY_PERMUTATION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/iter_move.h>
+#include "iterator_traits.h"
+#include "memory.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Prefetching: the permutation functions below access the
+    // elements in a random order, but the positions accessed a
+    // few steps later are known in advance
+
+    constexpr int permutation_prefetch_distance = 16;
+
+    template<typename RandomAccessIterator>
+    auto prefetch_element(RandomAccessIterator it, std::true_type)
+        -> void
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        // Prefetch every cache line of the element
+        using value_type = std::remove_reference_t<decltype(*it)>;
+        auto ptr = reinterpret_cast<const char*>(std::addressof(*it));
+        for (std::size_t offset = 0 ; offset < sizeof(value_type) ; offset += 64) {
+            __builtin_prefetch(ptr + offset);
+        }
+#else
+        (void)it;
+#endif
+    }
+
+    template<typename RandomAccessIterator>
+    auto prefetch_element(RandomAccessIterator, std::false_type)
+        -> void
+    {}
+
+    ////////////////////////////////////////////////////////////
+    // Move the elements of [first, last) so that the element
+    // originally found at position indices[n] ends up at the
+    // position n. The permutation is decomposed into cycles
+    // which are processed one after the other, which performs
+    // at most (3/2)n move operations.
+
+    template<typename RandomAccessIterator, typename IndexIterator>
+    auto apply_permutation(RandomAccessIterator first, RandomAccessIterator last,
+                           IndexIterator indices)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using can_prefetch = std::is_lvalue_reference<reference_t<RandomAccessIterator>>;
+
+        std::vector<bool> sorted(last - first, false);
+
+        // Element where the current cycle starts
+        auto start = first;
+
+        while (start != last) {
+            // Find the element to put in current's place
+            auto current = start;
+            auto current_pos = current - first;
+            auto next = first + static_cast<difference_type>(indices[current_pos]);
+            sorted[current_pos] = true;
+
+            // Process the current cycle
+            if (next != current) {
+                // Position a few steps ahead in the cycle
+                auto ahead = next - first;
+                for (int i = 0 ; i < permutation_prefetch_distance && ahead != start - first ; ++i) {
+                    ahead = static_cast<difference_type>(indices[ahead]);
+                }
+
+                auto tmp = iter_move(current);
+                while (next != start) {
+                    if (ahead != start - first) {
+                        prefetch_element(first + ahead, can_prefetch{});
+                        ahead = static_cast<difference_type>(indices[ahead]);
+                    }
+                    *current = iter_move(next);
+                    current = next;
+                    current_pos = next - first;
+                    next = first + static_cast<difference_type>(indices[current_pos]);
+                    sorted[current_pos] = true;
+                }
+                *current = std::move(tmp);
+            }
+
+            // Find the next cycle
+            do {
+                ++start;
+            } while (start != last && sorted[start - first]);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Move the elements of [first, last) so that the element
+    // originally found at position n ends up at the position
+    // indices[n], following cycles like the function above
+
+    template<typename RandomAccessIterator, typename IndexIterator>
+    auto apply_inverse_permutation(RandomAccessIterator first, RandomAccessIterator last,
+                                   IndexIterator indices)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using can_prefetch = std::is_lvalue_reference<reference_t<RandomAccessIterator>>;
+
+        std::vector<bool> sorted(last - first, false);
+
+        for (difference_type start = 0 ; start != last - first ; ++start) {
+            if (sorted[start]) continue;
+            sorted[start] = true;
+
+            // The element held in tmp always belongs at position next
+            auto next = static_cast<difference_type>(indices[start]);
+            if (next == start) continue;
+
+            auto ahead = next;
+            for (int i = 0 ; i < permutation_prefetch_distance && ahead != start ; ++i) {
+                ahead = static_cast<difference_type>(indices[ahead]);
+            }
+
+            auto tmp = iter_move(first + start);
+            while (next != start) {
+                if (ahead != start) {
+                    prefetch_element(first + ahead, can_prefetch{});
+                    ahead = static_cast<difference_type>(indices[ahead]);
+                }
+                auto tmp2 = iter_move(first + next);
+                first[next] = std::move(tmp);
+                tmp = std::move(tmp2);
+                sorted[next] = true;
+                next = static_cast<difference_type>(indices[next]);
+            }
+            first[start] = std::move(tmp);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Out-of-place variants: the elements are gathered (or
+    // scattered) into a buffer of the same size as the collection
+    // then moved back, which performs 2n move operations. Unlike
+    // cycle-following, every write is sequential, and the random
+    // reads are prefetched a few elements ahead, which makes them
+    // faster for collections that don't fit in the cache.
+
+    template<typename RandomAccessIterator, typename IndexIterator>
+    auto apply_permutation_buffered(RandomAccessIterator first, RandomAccessIterator last,
+                                    IndexIterator indices,
+                                    rvalue_type_t<RandomAccessIterator>* buffer)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using rvalue_type = rvalue_type_t<RandomAccessIterator>;
+        using can_prefetch = std::is_lvalue_reference<reference_t<RandomAccessIterator>>;
+
+        auto size = last - first;
+        destruct_n<rvalue_type> d(0);
+        std::unique_ptr<rvalue_type, destruct_n<rvalue_type>&> h(buffer, d);
+
+        for (difference_type i = 0 ; i != size ; ++i) {
+            if (i + permutation_prefetch_distance < size) {
+                auto ahead = indices[i + permutation_prefetch_distance];
+                prefetch_element(first + static_cast<difference_type>(ahead), can_prefetch{});
+            }
+            ::new(buffer + i) rvalue_type(iter_move(first + static_cast<difference_type>(indices[i])));
+            ++d;
+        }
+        std::move(buffer, buffer + size, first);
+    }
+
+    template<typename RandomAccessIterator, typename IndexIterator>
+    auto apply_inverse_permutation_buffered(RandomAccessIterator first, RandomAccessIterator last,
+                                            IndexIterator indices,
+                                            rvalue_type_t<RandomAccessIterator>* buffer)
+        -> void
+    {
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        using rvalue_type = rvalue_type_t<RandomAccessIterator>;
+        static_assert(std::is_nothrow_move_constructible<rvalue_type>::value,
+                      "the elements are scattered to the buffer, which can't be undone safely");
+
+        // Elements are constructed out of order, all of them have
+        // to exist before the buffer can be cleaned up
+        auto size = last - first;
+        for (difference_type i = 0 ; i != size ; ++i) {
+            if (i + permutation_prefetch_distance < size) {
+                auto ahead = indices[i + permutation_prefetch_distance];
+                prefetch_element(buffer + static_cast<difference_type>(ahead), std::true_type{});
+            }
+            ::new(buffer + static_cast<difference_type>(indices[i])) rvalue_type(iter_move(first + i));
+        }
+
+        destruct_n<rvalue_type> d(static_cast<std::size_t>(size));
+        std::unique_ptr<rvalue_type, destruct_n<rvalue_type>&> h(buffer, d);
+        std::move(buffer, buffer + size, first);
+    }
+}}
+
+#endif // CPPSORT_DETAIL_APPLY_PERMUTATION_H_
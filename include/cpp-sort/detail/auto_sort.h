@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_AUTO_SORT_H_
+#define CPPSORT_DETAIL_AUTO_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorters/counting_sorter.h>
+#include <cpp-sort/sorters/drop_merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/sorters/verge_sorter.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include "config.h"
+#include "functional.h"
+#include "iterator_traits.h"
+#include "minmax_element.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Tuning constants
+
+    // Number of elements sampled to estimate the presortedness
+    constexpr int auto_sort_sample_size = 32;
+
+    // Under this size, the cost of the sampling phase is not
+    // negligible anymore compared to the cost of the sort
+    constexpr std::ptrdiff_t auto_sort_min_size = 1024;
+
+    ////////////////////////////////////////////////////////////
+    // Presortedness sample
+    //
+    // The sampled elements are evenly spaced in the collection:
+    // - descents is the number of sampled elements that are
+    //   followed by a strictly smaller element in the original
+    //   collection, which estimates the number of runs
+    // - inversions and equivalences count respectively the
+    //   pairs of sampled elements that are in the wrong order
+    //   and the pairs of sampled elements that compare
+    //   equivalent, which estimate the proportion of inversions
+    //   and the proportion of duplicates in the collection
+
+    struct presortedness_sample
+    {
+        int descents = 0;
+        int inversions = 0;
+        int equivalences = 0;
+
+        static constexpr int nb_pairs = auto_sort_sample_size * (auto_sort_sample_size - 1) / 2;
+    };
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto sample_presortedness(RandomAccessIterator first,
+                              difference_type_t<RandomAccessIterator> size,
+                              Compare compare, Projection projection)
+        -> presortedness_sample
+    {
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        presortedness_sample res;
+        RandomAccessIterator sampled[auto_sort_sample_size];
+
+        auto step = (size - 1) / auto_sort_sample_size;
+        auto it = first;
+        for (auto& sample_it: sampled) {
+            sample_it = it;
+            if (comp(proj(it[1]), proj(*it))) {
+                ++res.descents;
+            }
+            it += step;
+        }
+
+        for (int i = 0 ; i < auto_sort_sample_size ; ++i) {
+            auto&& value = proj(*sampled[i]);
+            for (int j = i + 1 ; j < auto_sort_sample_size ; ++j) {
+                auto&& other = proj(*sampled[j]);
+                if (comp(other, value)) {
+                    ++res.inversions;
+                } else if (not comp(value, other)) {
+                    ++res.equivalences;
+                }
+            }
+        }
+        return res;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Algorithms auto_sort can dispatch to
+
+    enum class auto_sort_algorithm
+    {
+        pdq_sort,
+        verge_sort,
+        drop_merge_sort,
+        counting_sort,
+        ska_sort
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Pick an algorithm for shuffled-looking collections
+
+    template<typename RandomAccessIterator>
+    auto pick_auto_sort_shuffled(std::false_type, std::false_type,
+                                 RandomAccessIterator, RandomAccessIterator,
+                                 difference_type_t<RandomAccessIterator>,
+                                 const presortedness_sample&)
+        -> auto_sort_algorithm
+    {
+        return auto_sort_algorithm::pdq_sort;
+    }
+
+    template<typename RandomAccessIterator>
+    auto pick_auto_sort_shuffled(std::false_type, std::true_type,
+                                 RandomAccessIterator, RandomAccessIterator,
+                                 difference_type_t<RandomAccessIterator>,
+                                 const presortedness_sample& sample)
+        -> auto_sort_algorithm
+    {
+        // Pattern-defeating quicksort's three-way partitioning
+        // handles collections with few distinct values better
+        // than radix sort does
+        if (sample.equivalences * 8 >= presortedness_sample::nb_pairs) {
+            return auto_sort_algorithm::pdq_sort;
+        }
+        return auto_sort_algorithm::ska_sort;
+    }
+
+    template<typename RandomAccessIterator, typename RadixSortable>
+    auto pick_auto_sort_shuffled(std::true_type, RadixSortable is_radix_sortable,
+                                 RandomAccessIterator first, RandomAccessIterator last,
+                                 difference_type_t<RandomAccessIterator> size,
+                                 const presortedness_sample& sample)
+        -> auto_sort_algorithm
+    {
+        // Counting sort only pays off when the range of values is
+        // dense enough, which requires to know the exact range
+        auto bounds = detail::minmax_element(first, last, std::less<>{}, utility::identity{});
+        auto range = static_cast<std::uintmax_t>(*bounds.second) - static_cast<std::uintmax_t>(*bounds.first);
+        if (range > static_cast<std::uintmax_t>(size)) {
+            return pick_auto_sort_shuffled(std::false_type{}, is_radix_sortable,
+                                           first, last, size, sample);
+        }
+        return auto_sort_algorithm::counting_sort;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sample the collection, then pick the algorithm that best
+    // suits the estimated presortedness
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    using is_auto_sort_countable = std::integral_constant<bool,
+        is_integral<value_type_t<RandomAccessIterator>>::value &&
+        sizeof(value_type_t<RandomAccessIterator>) <= sizeof(std::uintmax_t) &&
+        is_identity<Projection>::value && (
+            is_natural_less<Compare, projected_t<RandomAccessIterator, Projection>>::value ||
+            is_natural_greater<Compare, projected_t<RandomAccessIterator, Projection>>::value
+        )
+    >;
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    using is_auto_sort_radix_sortable = std::integral_constant<bool,
+        is_ska_sortable_v<projected_t<RandomAccessIterator, Projection>> &&
+        is_natural_less<Compare, projected_t<RandomAccessIterator, Projection>>::value
+    >;
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto pick_auto_sort_algorithm(RandomAccessIterator first, RandomAccessIterator last,
+                                  Compare& compare, Projection& projection)
+        -> auto_sort_algorithm
+    {
+        auto size = last - first;
+        if (size < auto_sort_min_size) {
+            return auto_sort_algorithm::pdq_sort;
+        }
+
+        auto sample = sample_presortedness(first, size, compare, projection);
+
+        if (sample.descents == 0 || sample.descents == auto_sort_sample_size) {
+            // No descent or only descents: the collection is likely
+            // made of long ascending or descending runs
+            return auto_sort_algorithm::verge_sort;
+        }
+
+        if (sample.inversions * 16 <= presortedness_sample::nb_pairs) {
+            // Few inversions: the collection is likely sorted save
+            // for a few elements out of place
+            return auto_sort_algorithm::drop_merge_sort;
+        }
+
+        using is_countable = is_auto_sort_countable<RandomAccessIterator, Compare, Projection>;
+        using is_radix_sortable = is_auto_sort_radix_sortable<RandomAccessIterator, Compare, Projection>;
+        return pick_auto_sort_shuffled(is_countable{}, is_radix_sortable{},
+                                       first, last, size, sample);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Run the algorithms that only handle some collections,
+    // they are never picked for the other ones
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto auto_sort_counting(std::true_type,
+                            RandomAccessIterator first, RandomAccessIterator last,
+                            Compare, Projection)
+        -> void
+    {
+        if (is_natural_less<Compare, value_type_t<RandomAccessIterator>>::value) {
+            counting_sorter{}(std::move(first), std::move(last));
+        } else {
+            counting_sorter{}(std::move(first), std::move(last), std::greater<>{});
+        }
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto auto_sort_counting(std::false_type,
+                            RandomAccessIterator, RandomAccessIterator,
+                            Compare, Projection)
+        -> void
+    {
+        CPPSORT_UNREACHABLE;
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto auto_sort_ska(std::true_type,
+                       RandomAccessIterator first, RandomAccessIterator last,
+                       Compare, Projection projection)
+        -> void
+    {
+        ska_sorter{}(std::move(first), std::move(last), std::move(projection));
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto auto_sort_ska(std::false_type,
+                       RandomAccessIterator, RandomAccessIterator,
+                       Compare, Projection)
+        -> void
+    {
+        CPPSORT_UNREACHABLE;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sort with the picked algorithm
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto auto_sort(RandomAccessIterator first, RandomAccessIterator last,
+                   Compare compare, Projection projection)
+        -> void
+    {
+        switch (pick_auto_sort_algorithm(first, last, compare, projection)) {
+            case auto_sort_algorithm::verge_sort:
+                verge_sorter{}(std::move(first), std::move(last),
+                               std::move(compare), std::move(projection));
+                break;
+            case auto_sort_algorithm::drop_merge_sort:
+                drop_merge_sorter{}(std::move(first), std::move(last),
+                                    std::move(compare), std::move(projection));
+                break;
+            case auto_sort_algorithm::counting_sort:
+                auto_sort_counting(is_auto_sort_countable<RandomAccessIterator, Compare, Projection>{},
+                                   std::move(first), std::move(last),
+                                   std::move(compare), std::move(projection));
+                break;
+            case auto_sort_algorithm::ska_sort:
+                auto_sort_ska(is_auto_sort_radix_sortable<RandomAccessIterator, Compare, Projection>{},
+                              std::move(first), std::move(last),
+                              std::move(compare), std::move(projection));
+                break;
+            default:
+                pdq_sorter{}(std::move(first), std::move(last),
+                             std::move(compare), std::move(projection));
+                break;
+        }
+    }
+}}
+
+#endif // CPPSORT_DETAIL_AUTO_SORT_H_
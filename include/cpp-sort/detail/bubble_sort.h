@@ -9,6 +9,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <iterator>
+#include "config.h"
 #include "iterator_traits.h"
 #include "swap_if.h"
 
@@ -27,6 +28,7 @@ namespace detail
     //
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto bubble_sort(ForwardIterator first, difference_type_t<ForwardIterator> size,
                      Compare compare, Projection projection)
         -> void
@@ -51,6 +51,25 @@
 #   endif
 #endif
 
+// Some sorters can be used in constant expressions, which
+// requires constexpr std::swap & co, std::is_constant_evaluated
+// and allocations in constant expressions: all of them are
+// C++20 features
+
+#if __has_include(<version>)
+#   include <version>
+#endif
+
+#ifndef CPPSORT_CONSTEXPR_AFTER_CXX17
+#   if defined(__cpp_lib_constexpr_algorithms) && \
+       defined(__cpp_lib_is_constant_evaluated) && \
+       defined(__cpp_constexpr_dynamic_alloc)
+#       define CPPSORT_CONSTEXPR_AFTER_CXX17 constexpr
+#   else
+#       define CPPSORT_CONSTEXPR_AFTER_CXX17
+#   endif
+#endif
+
 ////////////////////////////////////////////////////////////
 // CPPSORT_ASSUME
 
@@ -115,6 +134,56 @@
 #   endif
 #endif
 
+////////////////////////////////////////////////////////////
+// Algorithm thresholds
+
+// The sizes under which hybrid algorithms switch to a simpler
+// algorithm depend on the hardware, on the type of the elements
+// and on the cost of the comparison: they can be overridden one
+// by one, or all at once by defining CPPSORT_THRESHOLDS_PROFILE
+// to the path of a header generated by the calibration program
+// found in the benchmarks directory
+
+#ifdef CPPSORT_THRESHOLDS_PROFILE
+#   include CPPSORT_THRESHOLDS_PROFILE
+#endif
+
+#ifndef CPPSORT_SORTING_NETWORK_THRESHOLD
+#   define CPPSORT_SORTING_NETWORK_THRESHOLD 32
+#endif
+
+#ifndef CPPSORT_PDQSORT_INSERTION_SORT_THRESHOLD
+#   define CPPSORT_PDQSORT_INSERTION_SORT_THRESHOLD 24
+#endif
+
+#ifndef CPPSORT_PDQSORT_NINTHER_THRESHOLD
+#   define CPPSORT_PDQSORT_NINTHER_THRESHOLD 128
+#endif
+
+#ifndef CPPSORT_QUICKSORT_BUBBLE_SORT_THRESHOLD
+#   define CPPSORT_QUICKSORT_BUBBLE_SORT_THRESHOLD 10
+#endif
+
+#ifndef CPPSORT_QUICKSORT_INSERTION_SORT_THRESHOLD
+#   define CPPSORT_QUICKSORT_INSERTION_SORT_THRESHOLD 42
+#endif
+
+#ifndef CPPSORT_MERGE_SORT_BUBBLE_SORT_THRESHOLD
+#   define CPPSORT_MERGE_SORT_BUBBLE_SORT_THRESHOLD 14
+#endif
+
+#ifndef CPPSORT_MERGE_SORT_INSERTION_SORT_THRESHOLD
+#   define CPPSORT_MERGE_SORT_INSERTION_SORT_THRESHOLD 40
+#endif
+
+#ifndef CPPSORT_SKA_SORT_PDQSORT_THRESHOLD
+#   define CPPSORT_SKA_SORT_PDQSORT_THRESHOLD 128
+#endif
+
+#ifndef CPPSORT_SKA_SORT_AMERICAN_FLAG_SORT_THRESHOLD
+#   define CPPSORT_SKA_SORT_AMERICAN_FLAG_SORT_THRESHOLD 1024
+#endif
+
 ////////////////////////////////////////////////////////////
 // CPPSORT_DEPRECATED
 
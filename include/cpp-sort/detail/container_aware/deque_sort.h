@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTAINER_AWARE_DEQUE_SORT_H_
+#define CPPSORT_DETAIL_CONTAINER_AWARE_DEQUE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <deque>
+#include <memory>
+#include <utility>
+#include <cpp-sort/adapters/out_of_place_adapter.h>
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Sorting an std::deque with a random-access sorter: the
+    // elements of a deque are stored in fixed-size blocks, and
+    // its iterators have to check for block boundaries whenever
+    // they move, which makes them noticeably slower than raw
+    // pointers for algorithms that perform many accesses.
+    //
+    // When the whole deque lives in a single block, it is sorted
+    // in place through pointers. Otherwise the elements are moved
+    // block by block to a contiguous buffer, which is sorted then
+    // moved back to the deque. Sorting the blocks independently
+    // and merging them was also considered, but merging thousands
+    // of small blocks turned out to be several times slower than
+    // sorting the deque directly.
+
+    template<typename Sorter, typename T, typename Allocator, typename... Args>
+    auto deque_sort(const Sorter& sorter, std::deque<T, Allocator>& collection, Args&&... args)
+        -> void
+    {
+        if (collection.size() < 2) return;
+
+        // Check whether the elements are contiguous, which stops at
+        // the end of the first block for deques spanning several
+        // blocks
+        auto first = collection.begin();
+        auto last = collection.end();
+        T* ptr = std::addressof(*first);
+        auto it = first;
+        T* expected = ptr;
+        while (it != last && std::addressof(*it) == expected) {
+            ++it;
+            ++expected;
+        }
+
+        if (it == last) {
+            sorter(ptr, expected, std::forward<Args>(args)...);
+        } else {
+            sort_out_of_place(first, last, collection.size(), sorter, std::forward<Args>(args)...);
+        }
+    }
+}}
+
+#endif // CPPSORT_DETAIL_CONTAINER_AWARE_DEQUE_SORT_H_
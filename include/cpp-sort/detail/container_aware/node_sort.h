@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTAINER_AWARE_NODE_SORT_H_
+#define CPPSORT_DETAIL_CONTAINER_AWARE_NODE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <forward_list>
+#include <iterator>
+#include <list>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include "../functional.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Sorting the nodes of a list with a random-access sorting
+    // algorithm: handles to the nodes are gathered into a
+    // contiguous array which is sorted, then the nodes are
+    // relinked in sorted order with a single pass of splice
+    // operations. The values are never moved, and iterators
+    // to the elements of the list remain valid.
+    //
+    // This avoids the many passes over the scattered nodes that
+    // a merge sort performs, but the sorting algorithm still has
+    // to follow a handle to read each value it compares.
+    //
+    // The sort parameter is called with a pair of iterators to
+    // the handles and a projection that gets the projected value
+    // from a handle.
+
+    template<typename Sort, typename Projection, typename... Args>
+    auto list_node_sort(std::list<Args...>& collection, Sort sort, Projection projection)
+        -> void
+    {
+        if (collection.size() < 2) return;
+
+        std::vector<typename std::list<Args...>::iterator> iterators;
+        iterators.reserve(collection.size());
+        for (auto it = collection.begin() ; it != collection.end() ; ++it) {
+            iterators.push_back(it);
+        }
+
+        sort(iterators.begin(), iterators.end(), indirect(std::move(projection)));
+
+        // Move every node to the end of the list in sorted order
+        for (auto it: iterators) {
+            collection.splice(collection.end(), collection, it);
+        }
+    }
+
+    template<typename Sort, typename Projection, typename... Args>
+    auto flist_node_sort(std::forward_list<Args...>& collection, Sort sort, Projection projection)
+        -> void
+    {
+        if (collection.empty() || std::next(collection.begin()) == collection.end()) return;
+
+        // The nodes of a forward_list can only be unlinked through
+        // their predecessor, which changes while the list is being
+        // relinked: store each node in its own single-element list
+        // instead of using iterators
+        using list_t = std::forward_list<Args...>;
+        auto size = std::distance(collection.begin(), collection.end());
+        std::vector<list_t> nodes;
+        nodes.reserve(size);
+        // The lists themselves are never moved by the sorting
+        // algorithm, which sorts pointers to them instead: it would
+        // otherwise lose the nodes held in its temporaries if the
+        // comparison or the projection were to throw
+        std::vector<list_t*> handles;
+        handles.reserve(size);
+
+        try {
+            while (not collection.empty()) {
+                nodes.emplace_back(collection.get_allocator());
+                nodes.back().splice_after(nodes.back().before_begin(),
+                                          collection, collection.before_begin());
+                handles.push_back(&nodes.back());
+            }
+
+            auto&& proj = utility::as_function(projection);
+            sort(handles.begin(), handles.end(), [&proj](list_t* list) -> decltype(auto) {
+                return proj(list->front());
+            });
+        } catch (...) {
+            // Give the nodes back to the collection in their original
+            // order, followed by the ones that were never moved out
+            for (auto it = nodes.rbegin() ; it != nodes.rend() ; ++it) {
+                collection.splice_after(collection.before_begin(), *it, it->before_begin());
+            }
+            throw;
+        }
+
+        // Relink the nodes front to back, starting from the greatest
+        for (auto it = handles.rbegin() ; it != handles.rend() ; ++it) {
+            collection.splice_after(collection.before_begin(), **it, (*it)->before_begin());
+        }
+    }
+}}
+
+#endif // CPPSORT_DETAIL_CONTAINER_AWARE_NODE_SORT_H_
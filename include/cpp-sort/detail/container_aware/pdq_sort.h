@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTAINER_AWARE_PDQ_SORT_H_
+#define CPPSORT_DETAIL_CONTAINER_AWARE_PDQ_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <deque>
+#include <forward_list>
+#include <functional>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../pdqsort.h"
+#include "../type_traits.h"
+#include "deque_sort.h"
+#include "node_sort.h"
+
+namespace cppsort
+{
+    namespace detail
+    {
+        template<typename Compare, typename Projection, typename... Args>
+        auto list_pdq_sort(std::list<Args...>& collection,
+                           Compare compare, Projection projection)
+            -> void
+        {
+            list_node_sort(collection, [&compare](auto first, auto last, auto proj) {
+                pdqsort(std::move(first), std::move(last), compare, std::move(proj));
+            }, std::move(projection));
+        }
+
+        template<typename Compare, typename Projection, typename... Args>
+        auto flist_pdq_sort(std::forward_list<Args...>& collection,
+                            Compare compare, Projection projection)
+            -> void
+        {
+            flist_node_sort(collection, [&compare](auto first, auto last, auto proj) {
+                pdqsort(std::move(first), std::move(last), compare, std::move(proj));
+            }, std::move(projection));
+        }
+    }
+
+    template<>
+    struct container_aware_adapter<pdq_sorter>:
+        detail::container_aware_adapter_base<pdq_sorter>,
+        detail::sorter_facade_fptr<
+            container_aware_adapter<pdq_sorter>,
+            std::is_empty<pdq_sorter>::value
+        >
+    {
+        using detail::container_aware_adapter_base<pdq_sorter>::operator();
+
+        container_aware_adapter() = default;
+        constexpr explicit container_aware_adapter(pdq_sorter) noexcept {}
+
+        ////////////////////////////////////////////////////////////
+        // std::deque
+
+        template<typename... Args>
+        auto operator()(std::deque<Args...>& iterable) const
+            -> void
+        {
+            detail::deque_sort(pdq_sorter{}, iterable);
+        }
+
+        template<typename Compare, typename... Args>
+        auto operator()(std::deque<Args...>& iterable, Compare compare) const
+            -> detail::enable_if_t<
+                is_projection_v<utility::identity, std::deque<Args...>, Compare>
+            >
+        {
+            detail::deque_sort(pdq_sorter{}, iterable, std::move(compare));
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::deque<Args...>& iterable, Projection projection) const
+            -> detail::enable_if_t<
+                is_projection_v<Projection, std::deque<Args...>>
+            >
+        {
+            detail::deque_sort(pdq_sorter{}, iterable, std::move(projection));
+        }
+
+        template<
+            typename Compare,
+            typename Projection,
+            typename... Args,
+            typename = detail::enable_if_t<
+                is_projection_v<Projection, std::deque<Args...>, Compare>
+            >
+        >
+        auto operator()(std::deque<Args...>& iterable,
+                        Compare compare, Projection projection) const
+            -> void
+        {
+            detail::deque_sort(pdq_sorter{}, iterable,
+                               std::move(compare), std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // std::list
+
+        template<typename... Args>
+        auto operator()(std::list<Args...>& iterable) const
+            -> void
+        {
+            detail::list_pdq_sort(iterable, std::less<>{}, utility::identity{});
+        }
+
+        template<typename Compare, typename... Args>
+        auto operator()(std::list<Args...>& iterable, Compare compare) const
+            -> detail::enable_if_t<
+                is_projection_v<utility::identity, std::list<Args...>, Compare>
+            >
+        {
+            detail::list_pdq_sort(iterable, std::move(compare), utility::identity{});
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::list<Args...>& iterable, Projection projection) const
+            -> detail::enable_if_t<
+                is_projection_v<Projection, std::list<Args...>>
+            >
+        {
+            detail::list_pdq_sort(iterable, std::less<>{}, std::move(projection));
+        }
+
+        template<
+            typename Compare,
+            typename Projection,
+            typename... Args,
+            typename = detail::enable_if_t<
+                is_projection_v<Projection, std::list<Args...>, Compare>
+            >
+        >
+        auto operator()(std::list<Args...>& iterable,
+                        Compare compare, Projection projection) const
+            -> void
+        {
+            detail::list_pdq_sort(iterable, std::move(compare), std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // std::forward_list
+
+        template<typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable) const
+            -> void
+        {
+            detail::flist_pdq_sort(iterable, std::less<>{}, utility::identity{});
+        }
+
+        template<typename Compare, typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable, Compare compare) const
+            -> detail::enable_if_t<
+                is_projection_v<utility::identity, std::forward_list<Args...>, Compare>
+            >
+        {
+            detail::flist_pdq_sort(iterable, std::move(compare), utility::identity{});
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable, Projection projection) const
+            -> detail::enable_if_t<
+                is_projection_v<Projection, std::forward_list<Args...>>
+            >
+        {
+            detail::flist_pdq_sort(iterable, std::less<>{}, std::move(projection));
+        }
+
+        template<
+            typename Compare,
+            typename Projection,
+            typename... Args,
+            typename = detail::enable_if_t<
+                is_projection_v<Projection, std::forward_list<Args...>, Compare>
+            >
+        >
+        auto operator()(std::forward_list<Args...>& iterable,
+                        Compare compare, Projection projection) const
+            -> void
+        {
+            detail::flist_pdq_sort(iterable, std::move(compare), std::move(projection));
+        }
+    };
+}
+
+#endif // CPPSORT_DETAIL_CONTAINER_AWARE_PDQ_SORT_H_
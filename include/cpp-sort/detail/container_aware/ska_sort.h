@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_CONTAINER_AWARE_SKA_SORT_H_
+#define CPPSORT_DETAIL_CONTAINER_AWARE_SKA_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <deque>
+#include <forward_list>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/fwd.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../iterator_traits.h"
+#include "../ska_sort.h"
+#include "../type_traits.h"
+#include "deque_sort.h"
+#include "node_sort.h"
+
+namespace cppsort
+{
+    namespace detail
+    {
+        template<typename Projection, typename... Args>
+        auto list_ska_sort(std::list<Args...>& collection, Projection projection)
+            -> void
+        {
+            list_node_sort(collection, [](auto first, auto last, auto proj) {
+                ska_sort(std::move(first), std::move(last), std::move(proj));
+            }, std::move(projection));
+        }
+
+        template<typename Projection, typename... Args>
+        auto flist_ska_sort(std::forward_list<Args...>& collection, Projection projection)
+            -> void
+        {
+            flist_node_sort(collection, [](auto first, auto last, auto proj) {
+                ska_sort(std::move(first), std::move(last), std::move(proj));
+            }, std::move(projection));
+        }
+    }
+
+    template<>
+    struct container_aware_adapter<ska_sorter>:
+        detail::container_aware_adapter_base<ska_sorter>,
+        detail::sorter_facade_fptr<
+            container_aware_adapter<ska_sorter>,
+            std::is_empty<ska_sorter>::value
+        >
+    {
+        using detail::container_aware_adapter_base<ska_sorter>::operator();
+
+        container_aware_adapter() = default;
+        constexpr explicit container_aware_adapter(ska_sorter) noexcept {}
+
+        ////////////////////////////////////////////////////////////
+        // std::deque
+
+        template<typename... Args>
+        auto operator()(std::deque<Args...>& iterable) const
+            -> detail::enable_if_t<
+                detail::is_ska_sortable_v<
+                    detail::projected_t<typename std::deque<Args...>::iterator, utility::identity>
+                >
+            >
+        {
+            detail::deque_sort(ska_sorter{}, iterable);
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::deque<Args...>& iterable, Projection projection) const
+            -> detail::enable_if_t<
+                is_projection_v<Projection, std::deque<Args...>> &&
+                detail::is_ska_sortable_v<
+                    detail::projected_t<typename std::deque<Args...>::iterator, Projection>
+                >
+            >
+        {
+            detail::deque_sort(ska_sorter{}, iterable, std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // std::list
+
+        template<typename... Args>
+        auto operator()(std::list<Args...>& iterable) const
+            -> detail::enable_if_t<
+                detail::is_ska_sortable_v<
+                    detail::projected_t<typename std::list<Args...>::iterator, utility::identity>
+                >
+            >
+        {
+            detail::list_ska_sort(iterable, utility::identity{});
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::list<Args...>& iterable, Projection projection) const
+            -> detail::enable_if_t<
+                is_projection_v<Projection, std::list<Args...>> &&
+                detail::is_ska_sortable_v<
+                    detail::projected_t<typename std::list<Args...>::iterator, Projection>
+                >
+            >
+        {
+            detail::list_ska_sort(iterable, std::move(projection));
+        }
+
+        ////////////////////////////////////////////////////////////
+        // std::forward_list
+
+        template<typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable) const
+            -> detail::enable_if_t<
+                detail::is_ska_sortable_v<
+                    detail::projected_t<typename std::forward_list<Args...>::iterator, utility::identity>
+                >
+            >
+        {
+            detail::flist_ska_sort(iterable, utility::identity{});
+        }
+
+        template<typename Projection, typename... Args>
+        auto operator()(std::forward_list<Args...>& iterable, Projection projection) const
+            -> detail::enable_if_t<
+                is_projection_v<Projection, std::forward_list<Args...>> &&
+                detail::is_ska_sortable_v<
+                    detail::projected_t<typename std::forward_list<Args...>::iterator, Projection>
+                >
+            >
+        {
+            detail::flist_ska_sort(iterable, std::move(projection));
+        }
+    };
+}
+
+#endif // CPPSORT_DETAIL_CONTAINER_AWARE_SKA_SORT_H_
@@ -8,10 +8,14 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <functional>
 #include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "config.h"
+#include "iterator_traits.h"
 
 namespace cppsort
 {
@@ -101,6 +105,70 @@ namespace detail
         return invert_t<std::decay_t<Predicate>>(std::forward<Predicate>(pred));
     }
 
+    ////////////////////////////////////////////////////////////
+    // Comparisons known to implement the natural ascending or
+    // descending order of a type, which allows to replace them
+    // with any algorithm implementing the same order
+
+    template<typename Compare, typename T>
+    struct is_natural_less:
+        std::false_type
+    {};
+
+    template<typename T>
+    struct is_natural_less<std::less<>, T>:
+        std::true_type
+    {};
+
+#ifdef __cpp_lib_ranges
+    template<typename T>
+    struct is_natural_less<std::ranges::less, T>:
+        std::true_type
+    {};
+#endif
+
+    template<typename T>
+    struct is_natural_less<std::less<T>, T>:
+        std::true_type
+    {};
+
+    template<typename Compare, typename T>
+    struct is_natural_greater:
+        std::false_type
+    {};
+
+    template<typename T>
+    struct is_natural_greater<std::greater<>, T>:
+        std::true_type
+    {};
+
+#ifdef __cpp_lib_ranges
+    template<typename T>
+    struct is_natural_greater<std::ranges::greater, T>:
+        std::true_type
+    {};
+#endif
+
+    template<typename T>
+    struct is_natural_greater<std::greater<T>, T>:
+        std::true_type
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Projections known to return their argument unchanged
+
+    template<typename Projection>
+    struct is_identity:
+        std::is_same<Projection, utility::identity>
+    {};
+
+#if CPPSORT_STD_IDENTITY_AVAILABLE
+    template<>
+    struct is_identity<std::identity>:
+        std::true_type
+    {};
+#endif
+
     ////////////////////////////////////////////////////////////
     // indirect
 
@@ -142,6 +210,55 @@ namespace detail
     {
         return indirect_t<std::decay_t<Projection>>(std::forward<Projection>(proj));
     }
+
+    ////////////////////////////////////////////////////////////
+    // indexed: projects an index relative to a random-access
+    // iterator with the projection of the corresponding element
+
+    template<typename RandomAccessIterator, typename Projection>
+    class indexed_t
+    {
+        private:
+
+            using difference_type = difference_type_t<RandomAccessIterator>;
+
+            RandomAccessIterator first;
+            Projection projection;
+
+        public:
+
+            indexed_t() = delete;
+
+            indexed_t(RandomAccessIterator first, Projection projection):
+                first(std::move(first)),
+                projection(std::move(projection))
+            {}
+
+            template<typename Index>
+            auto operator()(Index index)
+                -> decltype(utility::as_function(projection)(*first))
+            {
+                auto&& proj = utility::as_function(projection);
+                return proj(*(first + static_cast<difference_type>(index)));
+            }
+
+            template<typename Index>
+            auto operator()(Index index) const
+                -> decltype(utility::as_function(projection)(*first))
+            {
+                auto&& proj = utility::as_function(projection);
+                return proj(*(first + static_cast<difference_type>(index)));
+            }
+    };
+
+    template<typename RandomAccessIterator, typename Projection>
+    auto indexed(RandomAccessIterator first, Projection&& proj)
+        -> indexed_t<RandomAccessIterator, std::decay_t<Projection>>
+    {
+        return indexed_t<RandomAccessIterator, std::decay_t<Projection>>(
+            std::move(first), std::forward<Projection>(proj)
+        );
+    }
 }}
 
 namespace cppsort
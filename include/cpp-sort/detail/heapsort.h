@@ -20,6 +20,7 @@
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
+#include "config.h"
 #include "iterator_traits.h"
 
 namespace cppsort
@@ -27,6 +28,7 @@ namespace cppsort
 namespace detail
 {
     template<typename Compare, typename RandomAccessIterator, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto sift_down(RandomAccessIterator first, RandomAccessIterator,
                    Compare compare, Projection projection,
                    difference_type_t<RandomAccessIterator> len,
@@ -85,6 +87,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto make_heap(RandomAccessIterator first, RandomAccessIterator last,
                    Compare compare, Projection projection)
         -> void
@@ -100,6 +103,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto push_heap(RandomAccessIterator first, RandomAccessIterator last,
                    Compare compare, Projection projection,
                    difference_type_t<RandomAccessIterator> len)
@@ -129,6 +133,7 @@ namespace detail
     }
 
     template<typename Compare, typename RandomAccessIterator, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto pop_heap(RandomAccessIterator first, RandomAccessIterator last,
                   Compare compare, Projection projection,
                   difference_type_t<RandomAccessIterator> len)
@@ -142,6 +147,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto sort_heap(RandomAccessIterator first, RandomAccessIterator last,
                    Compare compare, Projection projection)
         -> void
@@ -153,6 +159,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto heapsort(RandomAccessIterator first, RandomAccessIterator last,
                   Compare compare, Projection projection)
         -> void
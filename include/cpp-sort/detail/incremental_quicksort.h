@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_INCREMENTAL_QUICKSORT_H_
+#define CPPSORT_DETAIL_INCREMENTAL_QUICKSORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/branchless_traits.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "bitops.h"
+#include "heapsort.h"
+#include "insertion_sort.h"
+#include "iter_sort3.h"
+#include "iterator_traits.h"
+#include "pdqsort.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Incremental quicksort
+    //
+    // Incremental quicksort, described by Paredes and Navarro in
+    // Optimal Incremental Sorting, sorts a collection from left
+    // to right on demand: putting the elements [0, k) in their
+    // sorted position costs O(n + k log k) comparisons on average
+    // for a collection of size n.
+    //
+    // The algorithm partitions the leftmost unsorted range until
+    // the first element of that range is a pivot, remembering the
+    // positions of the pivots in a stack: once an element is in
+    // its sorted position, the top of the stack is the end of the
+    // next unsorted range. The partitioning scheme, choice of the
+    // pivots and patterns-breaking swaps are the ones of pdqsort,
+    // and the remaining range is sorted with heapsort when there
+    // were too many unbalanced partitions.
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    class incremental_quicksort
+    {
+        public:
+
+            using difference_type = difference_type_t<RandomAccessIterator>;
+
+            incremental_quicksort(RandomAccessIterator first, RandomAccessIterator last,
+                                  Compare compare, Projection projection):
+                first_(first),
+                sorted_end_(0),
+                bad_allowed_(last - first < 2 ? 0 : detail::log2(last - first)),
+                compare_(std::move(compare)),
+                projection_(std::move(projection))
+            {
+                pivots_.push_back({ last - first, 0 });
+            }
+
+            // Number of elements at the beginning of the collection
+            // that are known to be in their sorted position
+            auto sorted_end() const
+                -> difference_type
+            {
+                return sorted_end_;
+            }
+
+            // Put the elements [0, pos] in their sorted position,
+            // pos must be smaller than the size of the collection
+            auto sort_until(difference_type pos)
+                -> void
+            {
+                while (sorted_end_ <= pos) {
+                    auto bound = pivots_.back();
+                    if (bound.pos == sorted_end_) {
+                        // The next element is a previous pivot
+                        bad_allowed_ = bound.bad_allowed;
+                        pivots_.pop_back();
+                        ++sorted_end_;
+                        continue;
+                    }
+                    sort_step(first_ + sorted_end_, first_ + bound.pos);
+                }
+            }
+
+        private:
+
+            // Either sort [begin, end) or partition it around a new
+            // pivot and push the position of the latter on the stack
+            auto sort_step(RandomAccessIterator begin, RandomAccessIterator end)
+                -> void
+            {
+                using namespace pdqsort_detail;
+                using utility::iter_swap;
+                using value_type = value_type_t<RandomAccessIterator>;
+                using projected_type = projected_t<RandomAccessIterator, Projection>;
+
+                constexpr bool is_branchless =
+                    utility::is_probably_branchless_comparison_v<Compare, projected_type> &&
+                    utility::is_probably_branchless_projection_v<Projection, value_type>;
+
+                auto&& comp = utility::as_function(compare_);
+                auto&& proj = utility::as_function(projection_);
+                bool leftmost = sorted_end_ == 0;
+                difference_type size = end - begin;
+
+                // Small ranges and ranges where pivots were consistently
+                // bad are sorted in one go
+                if (size < insertion_sort_threshold) {
+                    if (leftmost) {
+                        insertion_sort(begin, end, compare_, projection_);
+                    } else {
+                        unguarded_insertion_sort(begin, end, compare_, projection_);
+                    }
+                    sorted_end_ += size;
+                    return;
+                }
+                if (bad_allowed_ <= 0) {
+                    heapsort(begin, end, compare_, projection_);
+                    sorted_end_ += size;
+                    return;
+                }
+
+                // Choose pivot as median of 3 or pseudomedian of 9
+                difference_type s2 = size / 2;
+                if (size > ninther_threshold) {
+                    iter_sort3(begin, begin + s2, end - 1, compare_, projection_);
+                    iter_sort3(begin + 1, begin + (s2 - 1), end - 2, compare_, projection_);
+                    iter_sort3(begin + 2, begin + (s2 + 1), end - 3, compare_, projection_);
+                    iter_sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), compare_, projection_);
+                    iter_swap(begin, begin + s2);
+                } else {
+                    iter_sort3(begin + s2, begin, end - 1, compare_, projection_);
+                }
+
+                // If the pivot is equivalent to the last sorted element,
+                // every element put to its left by partition_left is
+                // equivalent to it and thus in its sorted position
+                if (not leftmost && not comp(proj(*(begin - 1)), proj(*begin))) {
+                    auto pivot_pos = partition_left(begin, end, compare_, projection_);
+                    sorted_end_ += (pivot_pos - begin) + 1;
+                    return;
+                }
+
+                auto pivot_pos = (is_branchless ?
+                    partition_right_branchless(begin, end, compare_, projection_) :
+                    partition_right(begin, end, compare_, projection_)).first;
+
+                // Break patterns after unbalanced partitions, both new
+                // partitions get the same budget of bad partitions
+                difference_type l_size = pivot_pos - begin;
+                difference_type r_size = end - (pivot_pos + 1);
+                if (l_size < size / 8 || r_size < size / 8) {
+                    --bad_allowed_;
+                    if (l_size >= insertion_sort_threshold) {
+                        iter_swap(begin,         begin + l_size / 4);
+                        iter_swap(pivot_pos - 1, pivot_pos - l_size / 4);
+
+                        if (l_size > ninther_threshold) {
+                            iter_swap(begin + 1,     begin + (l_size / 4 + 1));
+                            iter_swap(begin + 2,     begin + (l_size / 4 + 2));
+                            iter_swap(pivot_pos - 2, pivot_pos - (l_size / 4 + 1));
+                            iter_swap(pivot_pos - 3, pivot_pos - (l_size / 4 + 2));
+                        }
+                    }
+                    if (r_size >= insertion_sort_threshold) {
+                        iter_swap(pivot_pos + 1, pivot_pos + (1 + r_size / 4));
+                        iter_swap(end - 1,       end - r_size / 4);
+
+                        if (r_size > ninther_threshold) {
+                            iter_swap(pivot_pos + 2, pivot_pos + (2 + r_size / 4));
+                            iter_swap(pivot_pos + 3, pivot_pos + (3 + r_size / 4));
+                            iter_swap(end - 2,       end - (1 + r_size / 4));
+                            iter_swap(end - 3,       end - (2 + r_size / 4));
+                        }
+                    }
+                }
+                pivots_.push_back({ sorted_end_ + l_size, bad_allowed_ });
+            }
+
+            // Position of a pivot, and number of unbalanced partitions
+            // allowed in the unsorted range that follows it
+            struct pivot
+            {
+                difference_type pos;
+                int bad_allowed;
+            };
+
+            RandomAccessIterator first_;
+            // Pivots that are still to the right of sorted_end_, with
+            // the size of the collection at the bottom of the stack
+            std::vector<pivot> pivots_;
+            difference_type sorted_end_;
+            // Number of unbalanced partitions allowed in the leftmost
+            // unsorted range
+            int bad_allowed_;
+            Compare compare_;
+            Projection projection_;
+    };
+}}
+
+#endif // CPPSORT_DETAIL_INCREMENTAL_QUICKSORT_H_
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_INDEX_SORT_H_
+#define CPPSORT_DETAIL_INDEX_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/utility/as_function.h>
+#include "apply_permutation.h"
+#include "config.h"
+#include "immovable_vector.h"
+#include "iterator_traits.h"
+#include "scope_exit.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    //
+    // Indirect sort of a random-access collection through an
+    // array of indices relative to its first element: the
+    // sorter is called to sort the indices, then the resulting
+    // permutation is applied to the original collection
+    //
+    // Whenever the size of the collection allows it, 32-bit
+    // indices are used instead of full iterators or 64-bit
+    // indices, which reduces the amount of auxiliary memory
+    // and makes the sort of the indices more cache-friendly
+    //
+
+    template<typename Index, typename Sorter, typename RandomAccessIterator, typename... Args>
+    auto sort_with_indices_impl(Sorter&& sorter,
+                                RandomAccessIterator first, RandomAccessIterator last,
+                                difference_type_t<RandomAccessIterator> size,
+                                Args&&... args)
+        -> decltype(auto)
+    {
+        // Narrow difference types make the compiler believe that
+        // a negative size can reach the allocation
+        CPPSORT_ASSUME(size >= 0);
+        immovable_vector<Index> indices(size);
+        for (Index idx = 0 ; idx != static_cast<Index>(size) ; ++idx) {
+            indices.emplace_back(idx);
+        }
+
+#ifndef __cpp_lib_uncaught_exceptions
+        // Sort the indices on pointed values
+        std::forward<Sorter>(sorter)(indices.begin(), indices.end(), std::forward<Args>(args)...);
+        // Move the values according to the sorted indices
+        apply_permutation(first, last, indices.begin());
+#else
+        // Work around the sorters that return void
+        auto exit_function = make_scope_success([&] {
+            // Move the values according to the sorted indices
+            apply_permutation(first, last, indices.begin());
+        });
+
+        if (size < 2) {
+            exit_function.deactivate();
+        }
+
+        // Sort the indices on pointed values
+        return std::forward<Sorter>(sorter)(indices.begin(), indices.end(), std::forward<Args>(args)...);
+#endif
+    }
+
+    template<typename Sorter, typename... Args>
+    struct can_use_compact_indices:
+        std::is_same<
+            invoke_result_t<Sorter, std::uint32_t*, std::uint32_t*, Args...>,
+            invoke_result_t<Sorter, std::size_t*, std::size_t*, Args...>
+        >
+    {};
+
+    template<typename Sorter, typename RandomAccessIterator, typename... Args>
+    auto sort_with_indices(std::true_type, Sorter&& sorter,
+                           RandomAccessIterator first, RandomAccessIterator last,
+                           difference_type_t<RandomAccessIterator> size,
+                           Args&&... args)
+        -> decltype(auto)
+    {
+        if (static_cast<std::uintmax_t>(size) <= std::numeric_limits<std::uint32_t>::max()) {
+            return sort_with_indices_impl<std::uint32_t>(std::forward<Sorter>(sorter),
+                                                         first, last, size,
+                                                         std::forward<Args>(args)...);
+        }
+        return sort_with_indices_impl<std::size_t>(std::forward<Sorter>(sorter),
+                                                   first, last, size,
+                                                   std::forward<Args>(args)...);
+    }
+
+    template<typename Sorter, typename RandomAccessIterator, typename... Args>
+    auto sort_with_indices(std::false_type, Sorter&& sorter,
+                           RandomAccessIterator first, RandomAccessIterator last,
+                           difference_type_t<RandomAccessIterator> size,
+                           Args&&... args)
+        -> decltype(auto)
+    {
+        // The result of the sorter depends on the type of the indices,
+        // always use full-width indices to get a consistent result type
+        return sort_with_indices_impl<std::size_t>(std::forward<Sorter>(sorter),
+                                                   first, last, size,
+                                                   std::forward<Args>(args)...);
+    }
+
+    template<typename Sorter, typename RandomAccessIterator, typename... Args>
+    auto sort_with_indices(Sorter&& sorter,
+                           RandomAccessIterator first, RandomAccessIterator last,
+                           difference_type_t<RandomAccessIterator> size,
+                           Args&&... args)
+        -> decltype(auto)
+    {
+        using compact_t = can_use_compact_indices<Sorter, std::decay_t<Args>...>;
+        return sort_with_indices(compact_t{}, std::forward<Sorter>(sorter),
+                                 first, last, size,
+                                 std::forward<Args>(args)...);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Stable sort through (key, index) pairs packed in 64-bit
+    // unsigned integers
+    //
+    // When the projected keys are integers of at most 32 bits
+    // compared with their natural order, the key is mapped to
+    // the high half of a 64-bit integer and the original index
+    // of the element to its low half: every packed value is
+    // unique, which means that any sorting algorithm sorts them
+    // stably, and the sorter only has to compare plain integers
+    //
+
+    template<typename Integer>
+    auto to_ordered_bits(Integer value)
+        -> std::uint32_t
+    {
+        // Flip the sign bit so that the unsigned order matches
+        // the order of the original signed values
+        std::uint32_t bits = value;
+        return is_signed<Integer>::value ? bits ^ 0x80000000u : bits;
+    }
+
+    template<
+        bool Descending,
+        typename Sorter,
+        typename RandomAccessIterator,
+        typename Projection
+    >
+    auto sort_with_packed_indices(Sorter&& sorter,
+                                  RandomAccessIterator first, RandomAccessIterator last,
+                                  difference_type_t<RandomAccessIterator> size,
+                                  Projection projection)
+        -> decltype(auto)
+    {
+        CPPSORT_ASSERT(static_cast<std::uintmax_t>(size) <= std::numeric_limits<std::uint32_t>::max());
+        auto&& proj = utility::as_function(projection);
+
+        immovable_vector<std::uint64_t> packed(size);
+        auto it = first;
+        for (std::uint64_t idx = 0 ; idx != static_cast<std::uint64_t>(size) ; ++idx) {
+            std::uint32_t key = to_ordered_bits(proj(*it));
+            if (Descending) {
+                key = ~key;
+            }
+            packed.emplace_back((std::uint64_t(key) << 32u) | idx);
+            ++it;
+        }
+
+        auto unpack_and_apply = [&] {
+            // Only keep the original indices, then move the values
+            for (auto& value: packed) {
+                value &= 0xffffffffu;
+            }
+            apply_permutation(first, last, packed.begin());
+        };
+
+#ifndef __cpp_lib_uncaught_exceptions
+        std::forward<Sorter>(sorter)(packed.begin(), packed.end());
+        unpack_and_apply();
+#else
+        // Work around the sorters that return void
+        auto exit_function = make_scope_success(unpack_and_apply);
+
+        if (size < 2) {
+            exit_function.deactivate();
+        }
+
+        return std::forward<Sorter>(sorter)(packed.begin(), packed.end());
+#endif
+    }
+}}
+
+#endif // CPPSORT_DETAIL_INDEX_SORT_H_
@@ -13,6 +13,7 @@
 #include <iterator>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
+#include "config.h"
 #include "iterator_traits.h"
 #include "memory.h"
 #include "recmerge_bidirectional.h"
@@ -29,6 +30,7 @@ namespace detail
 
     template<typename ForwardIterator, typename RandomAccessIterator,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(ForwardIterator first, ForwardIterator middle, ForwardIterator,
                        Compare compare, Projection projection,
                        difference_type_t<ForwardIterator> len1,
@@ -39,7 +41,8 @@ namespace detail
     {
         recmerge(std::move(first), len1, std::move(middle), len2,
                  buff, buff_size,
-                 std::move(compare), std::move(projection));
+                 std::move(compare), std::move(projection),
+                 std::forward_iterator_tag{});
     }
 
     ////////////////////////////////////////////////////////////
@@ -47,6 +50,7 @@ namespace detail
 
     template<typename BidirectionalIterator, typename RandomAccessIterator,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(BidirectionalIterator first, BidirectionalIterator middle,
                        BidirectionalIterator last,
                        Compare compare, Projection projection,
@@ -66,6 +70,7 @@ namespace detail
 
     template<typename RandomAccessIterator1, typename RandomAccessIterator2,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(RandomAccessIterator1 first, RandomAccessIterator1 middle,
                        RandomAccessIterator1 last,
                        Compare compare, Projection projection,
@@ -85,6 +90,7 @@ namespace detail
     // one wasn't passed
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(ForwardIterator first, ForwardIterator middle,
                        ForwardIterator last, Compare compare, Projection projection,
                        std::forward_iterator_tag)
@@ -106,10 +112,12 @@ namespace detail
         auto buffer = temporary_buffer<rvalue_type_t<ForwardIterator>>((std::max)(n0, n1));
         recmerge(std::move(first), n0, std::move(middle), n1,
                  buffer.data(), buffer.size(),
-                 std::move(compare), std::move(projection));
+                 std::move(compare), std::move(projection),
+                 std::forward_iterator_tag{});
     }
 
     template<typename BidirectionalIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(BidirectionalIterator first, BidirectionalIterator middle,
                        BidirectionalIterator last,
                        Compare compare, Projection projection,
@@ -128,6 +136,7 @@ namespace detail
     }
 
     template<typename BidirectionalIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(BidirectionalIterator first, BidirectionalIterator middle,
                        BidirectionalIterator last, Compare compare, Projection projection,
                        std::bidirectional_iterator_tag)
@@ -161,6 +170,7 @@ namespace detail
     // function depending on the iterator category
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(ForwardIterator first, ForwardIterator middle, ForwardIterator last,
                        Compare compare, Projection projection)
         -> void
@@ -172,6 +182,7 @@ namespace detail
     }
 
     template<typename BidirectionalIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(BidirectionalIterator first, BidirectionalIterator middle,
                        BidirectionalIterator last,
                        Compare compare, Projection projection,
@@ -191,6 +202,7 @@ namespace detail
 
     template<typename ForwardIterator, typename RandomAccessIterator,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto inplace_merge(ForwardIterator first, ForwardIterator middle, ForwardIterator last,
                        Compare compare, Projection projection,
                        difference_type_t<ForwardIterator> len1,
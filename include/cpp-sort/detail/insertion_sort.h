@@ -33,12 +33,14 @@
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
+#include "config.h"
 
 namespace cppsort
 {
 namespace detail
 {
     template<typename BidirectionalIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto insertion_sort(BidirectionalIterator first, BidirectionalIterator last,
                         Compare compare, Projection projection)
         -> void
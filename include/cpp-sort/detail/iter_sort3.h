@@ -9,6 +9,7 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <utility>
+#include "config.h"
 #include "swap_if.h"
 
 namespace cppsort
@@ -16,6 +17,7 @@ namespace cppsort
 namespace detail
 {
     template<typename Iterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto iter_sort3(Iterator a, Iterator b, Iterator c,
                     Compare compare, Projection projection)
         -> Iterator
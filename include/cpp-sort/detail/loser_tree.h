@@ -0,0 +1,341 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_LOSER_TREE_H_
+#define CPPSORT_DETAIL_LOSER_TREE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/as_function.h>
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Tournament tree of losers
+    //
+    // The tree selects the smallest of the front elements of k
+    // sorted sources with log2(k) comparisons per element once
+    // built, which is fewer than both repeated pairwise merges
+    // and a binary heap, the latter needing two comparisons per
+    // level to sift an element down.
+    //
+    // A source is any object providing the following functions:
+    // - empty(): whether the source is exhausted
+    // - front(): current element of the source
+    // - pop(): advance to the next element of the source
+    //
+    // Ties are broken in favour of the source with the smallest
+    // index, which makes the resulting merge stable. Sources that
+    // are empty from the start are removed before the first
+    // matches are played. A source exhausted during the merge
+    // stays in the tree but loses every match it plays from then
+    // on, which only requires to check whether the challenger of
+    // each match is exhausted.
+    //
+    // Nodes are stored in an implicit binary tree: leaves are
+    // the nodes [k, 2k) and node i > 1 has node i / 2 as parent.
+    // Inner nodes [1, k) store the index of the source that lost
+    // the match played at that node while node 0 stores the
+    // index of the overall winner.
+
+    ////////////////////////////////////////////////////////////
+    // Keys of the sources
+    //
+    // The matches along the path of a winner form a chain of
+    // dependent operations: reading the key of the winner of a
+    // match through its source costs two dependent loads before
+    // the next match can be played. Cheap keys - arithmetic types
+    // and pointers - are instead cached by value, and the key of
+    // the current winner is carried from a match to the next one.
+    // Other keys are always read through their source.
+
+    template<typename Source, typename Projection>
+    using loser_tree_key_t = remove_cvref_t<
+        invoke_result_t<Projection, decltype(std::declval<Source&>().front())>
+    >;
+
+    template<
+        typename Source,
+        typename Projection,
+        bool = std::is_arithmetic<loser_tree_key_t<Source, Projection>>::value
+            || std::is_pointer<loser_tree_key_t<Source, Projection>>::value
+    >
+    class loser_tree_keys
+    {
+        public:
+
+            // Handle to the key of a source, cheap to copy
+            using handle_type = loser_tree_key_t<Source, Projection>;
+
+            loser_tree_keys(std::size_t size, Projection projection):
+                keys_(size),
+                projection_(std::move(projection))
+            {}
+
+            // Cache the key of the current front of a source, and
+            // return a handle to that key
+            auto update(Source* sources, std::size_t index)
+                -> handle_type
+            {
+                auto&& proj = utility::as_function(projection_);
+                handle_type key = proj(sources[index].front());
+                keys_[index] = key;
+                return key;
+            }
+
+            auto handle(std::size_t index) const
+                -> handle_type
+            {
+                return keys_[index];
+            }
+
+            // Whether the source lhs wins its match against rhs: the
+            // keys are compared both ways, which is cheaper than
+            // selecting the comparison to perform
+            template<typename Compare>
+            auto beats(Compare& compare, Source*,
+                       std::size_t lhs, handle_type lhs_key,
+                       std::size_t rhs, handle_type rhs_key) const
+                -> bool
+            {
+                auto&& comp = utility::as_function(compare);
+                // lhs wins when it is strictly smaller than rhs, or when
+                // it is equivalent to rhs with a smaller index
+                bool lhs_less = comp(lhs_key, rhs_key);
+                bool rhs_less = comp(rhs_key, lhs_key);
+                return lhs_less | ((lhs < rhs) & not rhs_less);
+            }
+
+            // Whether the challenger of a match wins it: an exhausted
+            // challenger always loses, but its cached key can still be
+            // compared so both checks are performed without branches
+            template<typename Compare>
+            auto challenger_wins(Compare& compare, Source* sources,
+                                 std::size_t challenger, handle_type challenger_key,
+                                 std::size_t winner, handle_type winner_key) const
+                -> bool
+            {
+                return not sources[challenger].empty()
+                     & beats(compare, sources, challenger, challenger_key, winner, winner_key);
+            }
+
+        private:
+
+            std::vector<handle_type> keys_;
+            Projection projection_;
+    };
+
+    template<typename Source, typename Projection>
+    class loser_tree_keys<Source, Projection, false>
+    {
+        public:
+
+            // Handle to the key of a source: the index of the source
+            using handle_type = std::size_t;
+
+            loser_tree_keys(std::size_t, Projection projection):
+                projection_(std::move(projection))
+            {}
+
+            auto update(Source*, std::size_t index)
+                -> handle_type
+            {
+                return index;
+            }
+
+            auto handle(std::size_t index) const
+                -> handle_type
+            {
+                return index;
+            }
+
+            // Whether the source lhs wins its match against rhs
+            template<typename Compare>
+            auto beats(Compare& compare, Source* sources,
+                       std::size_t lhs, handle_type,
+                       std::size_t rhs, handle_type) const
+                -> bool
+            {
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection_);
+
+                // Equivalent elements are won by the smallest index: lhs
+                // wins when it is strictly smaller than rhs, or when it
+                // is equivalent with a smaller index, which only takes a
+                // single comparison of the source with the greater index
+                // against the other one
+                bool lhs_first = lhs < rhs;
+                auto high = lhs_first ? rhs : lhs;
+                auto low = lhs_first ? lhs : rhs;
+                return comp(proj(sources[high].front()), proj(sources[low].front())) != lhs_first;
+            }
+
+            // Whether the challenger of a match wins it: an exhausted
+            // challenger always loses, and has no front element to be
+            // compared with
+            template<typename Compare>
+            auto challenger_wins(Compare& compare, Source* sources,
+                                 std::size_t challenger, handle_type challenger_key,
+                                 std::size_t winner, handle_type winner_key) const
+                -> bool
+            {
+                return not sources[challenger].empty()
+                    && beats(compare, sources, challenger, challenger_key, winner, winner_key);
+            }
+
+        private:
+
+            Projection projection_;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Loser tree
+
+    template<typename Source, typename Compare, typename Projection>
+    class loser_tree
+    {
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Construction
+
+            loser_tree(Source* sources, std::size_t size,
+                       Compare compare, Projection projection):
+                sources_(sources),
+                size_(0),
+                live_(0),
+                nodes_(size == 0 ? 1 : size),
+                keys_(size, std::move(projection)),
+                compare_(std::move(compare))
+            {
+                // Only keep the sources that are not empty
+                for (std::size_t i = 0 ; i < size ; ++i) {
+                    if (not sources[i].empty()) {
+                        if (i != size_) {
+                            sources_[size_] = std::move(sources[i]);
+                        }
+                        keys_.update(sources_, size_);
+                        ++size_;
+                    }
+                }
+                live_ = size_;
+                if (size_ > 0) {
+                    nodes_[0] = build(1);
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Tournament
+
+            // Whether all the sources are exhausted
+            auto empty() const
+                -> bool
+            {
+                return live_ == 0;
+            }
+
+            // Source holding the smallest element
+            auto top() const
+                -> Source&
+            {
+                return sources_[nodes_[0]];
+            }
+
+            // Advance the winning source and replay the matches
+            // along the path from its leaf to the root
+            auto pop()
+                -> void
+            {
+                auto winner = nodes_[0];
+                sources_[winner].pop();
+                if (sources_[winner].empty()) {
+                    remove_source(winner);
+                    return;
+                }
+                auto winner_key = keys_.update(sources_, winner);
+                for (auto node = (winner + size_) / 2 ; node > 0 ; node /= 2) {
+                    // The outcome of the matches is unpredictable: the
+                    // indices are exchanged with bitwise operations and
+                    // the node is written unconditionally so that the
+                    // compiler doesn't turn the selects into branches
+                    auto challenger = nodes_[node];
+                    auto challenger_key = keys_.handle(challenger);
+                    bool challenger_wins = keys_.challenger_wins(compare_, sources_,
+                                                                 challenger, challenger_key,
+                                                                 winner, winner_key);
+                    auto swap_mask = std::size_t(0) - static_cast<std::size_t>(challenger_wins);
+                    auto swap_bits = (winner ^ challenger) & swap_mask;
+                    nodes_[node] = challenger ^ swap_bits;
+                    winner ^= swap_bits;
+                    winner_key = challenger_wins ? challenger_key : winner_key;
+                }
+                nodes_[0] = winner;
+            }
+
+        private:
+
+            // Whether the source lhs wins its match against rhs,
+            // ties are won by the source with the smallest index
+            auto beats(std::size_t lhs, std::size_t rhs)
+                -> bool
+            {
+                return keys_.beats(compare_, sources_, lhs, keys_.handle(lhs), rhs, keys_.handle(rhs));
+            }
+
+            // Replay the matches of a source that was just exhausted,
+            // it loses against every source that isn't exhausted
+            auto remove_source(std::size_t pos)
+                -> void
+            {
+                if (--live_ == 0) return;
+
+                auto winner = pos;
+                for (auto node = (pos + size_) / 2 ; node > 0 ; node /= 2) {
+                    auto challenger = nodes_[node];
+                    if (sources_[challenger].empty()) continue;
+                    if (sources_[winner].empty() || beats(challenger, winner)) {
+                        nodes_[node] = winner;
+                        winner = challenger;
+                    }
+                }
+                nodes_[0] = winner;
+            }
+
+            // Play the matches of the subtree rooted at node, and
+            // return the index of the winner of that subtree
+            auto build(std::size_t node)
+                -> std::size_t
+            {
+                if (node >= size_) {
+                    return node - size_;
+                }
+                auto lhs = build(2 * node);
+                auto rhs = build(2 * node + 1);
+                if (beats(lhs, rhs)) {
+                    nodes_[node] = rhs;
+                    return lhs;
+                }
+                nodes_[node] = lhs;
+                return rhs;
+            }
+
+            Source* sources_;
+            std::size_t size_;
+            std::size_t live_;
+            std::vector<std::size_t> nodes_;
+            loser_tree_keys<Source, Projection> keys_;
+            Compare compare_;
+    };
+}}
+
+#endif // CPPSORT_DETAIL_LOSER_TREE_H_
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_LOW_MOVES_CYCLE_SORT_H_
+#define CPPSORT_DETAIL_LOW_MOVES_CYCLE_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <utility>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/iter_move.h>
+#include "../iterator_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Move-optimal sort for small collections
+    //
+    // The final position of every element is computed by only
+    // comparing the elements, without moving them. The elements
+    // are then moved along the cycles of the resulting
+    // permutation: an element already at its final position is
+    // never moved, and a cycle of k elements is resolved with
+    // k+1 moves, which is the lowest possible number of moves
+    // when a single element can be held out of the collection.
+
+    // Biggest collection sorted with low_moves_cycle_sort, it
+    // performs a quadratic number of comparisons
+    constexpr std::size_t low_moves_cycle_sort_max_size = 16;
+
+    template<std::size_t N, typename RandomAccessIterator, typename Compare, typename Projection>
+    auto low_moves_cycle_sort(RandomAccessIterator first, Compare compare, Projection projection)
+        -> void
+    {
+        static_assert(N <= low_moves_cycle_sort_max_size,
+                      "low_moves_cycle_sort only handles small collections");
+
+        using utility::iter_move;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        // Final position of every element: the number of elements
+        // that compare less, plus the number of equivalent elements
+        // found before it. Every pair of elements is compared once
+        // and the results are accumulated without branches.
+        std::size_t ranks[N] = {};
+        for (std::size_t i = 1 ; i < N ; ++i) {
+            auto&& value = proj(first[static_cast<difference_type>(i)]);
+            for (std::size_t j = 0 ; j < i ; ++j) {
+                bool less = comp(value, proj(first[static_cast<difference_type>(j)]));
+                ranks[j] += less;
+                ranks[i] += not less;
+            }
+        }
+
+        // indices[n] is the original position of the element
+        // that ends up at the position n
+        std::size_t indices[N];
+        for (std::size_t i = 0 ; i < N ; ++i) {
+            indices[ranks[i]] = i;
+        }
+
+        // Move the elements along the cycles of the permutation,
+        // the processed positions are marked as fixed points
+        for (std::size_t start = 0 ; start < N ; ++start) {
+            if (indices[start] == start) continue;
+
+            auto current = start;
+            auto hole = first + static_cast<difference_type>(current);
+            auto tmp = iter_move(hole);
+            while (indices[current] != start) {
+                auto next = indices[current];
+                auto next_it = first + static_cast<difference_type>(next);
+                *hole = iter_move(next_it);
+                indices[current] = current;
+                current = next;
+                hole = next_it;
+            }
+            *hole = std::move(tmp);
+            indices[current] = current;
+        }
+    }
+}}
+
+#endif // CPPSORT_DETAIL_LOW_MOVES_CYCLE_SORT_H_
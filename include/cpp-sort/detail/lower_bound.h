@@ -12,6 +12,7 @@
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include "bitops.h"
+#include "config.h"
 #include "iterator_traits.h"
 
 namespace cppsort
@@ -20,6 +21,7 @@ namespace detail
 {
     template<typename ForwardIterator, typename T,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto lower_bound_n(ForwardIterator first, difference_type_t<ForwardIterator> size,
                        T&& value, Compare compare, Projection projection)
         -> ForwardIterator
@@ -41,6 +43,7 @@ namespace detail
 
     template<typename ForwardIterator, typename T,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto lower_bound(ForwardIterator first, ForwardIterator last, T&& value,
                      Compare compare, Projection projection)
         -> ForwardIterator
@@ -52,6 +55,7 @@ namespace detail
 
     template<typename ForwardIterator, typename T,
         typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto lower_monobound_n(ForwardIterator first, difference_type_t<ForwardIterator> size,
                            T&& value, Compare compare, Projection projection)
         -> ForwardIterator
@@ -22,6 +22,7 @@
 #include <memory>
 #include <new>
 #include <type_traits>
+#include "config.h"
 #include "type_traits.h"
 
 namespace cppsort
@@ -148,12 +149,20 @@ namespace detail
      * \a count objects. Failing that it will try to allocate storage
      * for fewer objects and will give up if it can't allocate more
      * than \a min_count objects.
+     *
+     * No memory is allocated in constant expressions: the algorithms
+     * using a temporary buffer have to fall back to their buffer-less
+     * variants in that case.
      */
     template<typename T>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto get_temporary_buffer(std::ptrdiff_t count, std::ptrdiff_t min_count) noexcept
         -> std::pair<T*, std::ptrdiff_t>
     {
         std::pair<T*, std::ptrdiff_t> res(nullptr, 0);
+        if (is_constant_evaluated()) {
+            return res;
+        }
 
         // Don't allocate more than possible
         constexpr ptrdiff_t max = std::numeric_limits<std::ptrdiff_t>::max() / sizeof(T);
@@ -175,9 +184,14 @@ namespace detail
     }
 
     template<typename T>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto return_temporary_buffer(T* ptr, std::size_t count) noexcept
         -> void
     {
+        if (is_constant_evaluated()) {
+            // Nothing was allocated
+            return;
+        }
 #ifdef __cpp_sized_deallocation
         ::operator delete(ptr, count * sizeof(T));
 #else
@@ -206,6 +220,7 @@ namespace detail
             temporary_buffer() = default;
             temporary_buffer(const temporary_buffer&) = delete;
 
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             temporary_buffer(temporary_buffer&& other) noexcept:
                 buffer(other.buffer),
                 buffer_size(other.buffer_size)
@@ -216,6 +231,7 @@ namespace detail
 
             constexpr temporary_buffer(std::nullptr_t) noexcept {}
 
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             explicit temporary_buffer(std::ptrdiff_t count) noexcept
             {
                 auto tmp = get_temporary_buffer<T>(count, 0);
@@ -223,6 +239,7 @@ namespace detail
                 buffer_size = tmp.second;
             }
 
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             ~temporary_buffer() noexcept
             {
                 return_temporary_buffer<T>(buffer, buffer_size);
@@ -233,6 +250,7 @@ namespace detail
 
             temporary_buffer& operator=(const temporary_buffer&) = delete;
 
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             auto operator=(temporary_buffer&& other) noexcept
                 -> temporary_buffer&
             {
@@ -245,13 +263,13 @@ namespace detail
             ////////////////////////////////////////////////////////////
             // Data access
 
-            auto data() const noexcept
+            constexpr auto data() const noexcept
                 -> pointer
             {
                 return buffer;
             }
 
-            auto size() const noexcept
+            constexpr auto size() const noexcept
                 -> std::ptrdiff_t
             {
                 return buffer_size;
@@ -260,6 +278,7 @@ namespace detail
             ////////////////////////////////////////////////////////////
             // Modifiers
 
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             auto try_grow(std::ptrdiff_t count) noexcept
                 -> bool
             {
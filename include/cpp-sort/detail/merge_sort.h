@@ -9,20 +9,32 @@
 // Headers
 ////////////////////////////////////////////////////////////
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include "bubble_sort.h"
+#include "config.h"
 #include "inplace_merge.h"
 #include "insertion_sort.h"
 #include "iterator_traits.h"
 #include "memory.h"
+#include "network_small_sort.h"
 #include "type_traits.h"
 
 namespace cppsort
 {
 namespace detail
 {
+    // Sorting networks are not stable: only use them to sort the
+    // small partitions when equivalent elements can't be told apart
+    template<typename Iterator, typename Compare, typename Projection>
+    using use_merge_sort_networks = std::integral_constant<bool,
+        use_network_small_sort<Iterator, Compare, Projection>::value &&
+        std::is_integral<value_type_t<Iterator>>::value
+    >;
+
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_sort_impl(ForwardIterator first, difference_type_t<ForwardIterator> size,
                          temporary_buffer<rvalue_type_t<ForwardIterator>>&& buffer,
                          Compare compare, Projection projection,
@@ -32,7 +44,7 @@ namespace detail
         auto&& comp = utility::as_function(compare);
         auto&& proj = utility::as_function(projection);
 
-        if (size < 14) {
+        if (size < CPPSORT_MERGE_SORT_BUBBLE_SORT_THRESHOLD) {
             bubble_sort(std::move(first), size,
                         std::move(compare), std::move(projection));
             return std::move(buffer);
@@ -74,6 +86,7 @@ namespace detail
     }
 
     template<typename BidirectionalIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_sort_impl(BidirectionalIterator first, BidirectionalIterator last,
                          difference_type_t<BidirectionalIterator> size,
                          temporary_buffer<rvalue_type_t<BidirectionalIterator>>&& buffer,
@@ -84,9 +97,12 @@ namespace detail
         auto&& comp = utility::as_function(compare);
         auto&& proj = utility::as_function(projection);
 
-        if (size < 40) {
-            insertion_sort(std::move(first), std::move(last),
-                           std::move(compare), std::move(projection));
+        if (size < CPPSORT_MERGE_SORT_INSERTION_SORT_THRESHOLD) {
+            using use_networks = use_merge_sort_networks<BidirectionalIterator, Compare, Projection>;
+            if (not network_small_sort(use_networks{}, first, last, compare, projection)) {
+                insertion_sort(std::move(first), std::move(last),
+                               std::move(compare), std::move(projection));
+            }
             return std::move(buffer);
         }
 
@@ -127,13 +143,14 @@ namespace detail
     }
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_sort(ForwardIterator first, ForwardIterator,
                     difference_type_t<ForwardIterator> size,
                     Compare compare, Projection projection,
                     std::forward_iterator_tag tag)
         -> void
     {
-        if (size < 14) {
+        if (size < CPPSORT_MERGE_SORT_BUBBLE_SORT_THRESHOLD) {
             bubble_sort(std::move(first), size,
                         std::move(compare), std::move(projection));
             return;
@@ -145,15 +162,19 @@ namespace detail
     }
 
     template<typename BidirectionalIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_sort(BidirectionalIterator first, BidirectionalIterator last,
                     difference_type_t<BidirectionalIterator> size,
                     Compare compare, Projection projection,
                     std::bidirectional_iterator_tag tag)
         -> void
     {
-        if (size < 40) {
-            insertion_sort(std::move(first), std::move(last),
-                           std::move(compare), std::move(projection));
+        if (size < CPPSORT_MERGE_SORT_INSERTION_SORT_THRESHOLD) {
+            using use_networks = use_merge_sort_networks<BidirectionalIterator, Compare, Projection>;
+            if (not network_small_sort(use_networks{}, first, last, compare, projection)) {
+                insertion_sort(std::move(first), std::move(last),
+                               std::move(compare), std::move(projection));
+            }
             return;
         }
 
@@ -163,6 +184,7 @@ namespace detail
     }
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_sort(ForwardIterator first, ForwardIterator last,
                     difference_type_t<ForwardIterator> size,
                     Compare compare, Projection projection)
@@ -12,6 +12,7 @@
 #include <iterator>
 #include <type_traits>
 #include <cpp-sort/utility/iter_move.h>
+#include "config.h"
 #include "iterator_traits.h"
 #include "memory.h"
 #include "type_traits.h"
@@ -55,6 +56,7 @@ namespace detail
     // move
 
     template<typename InputIterator, typename OutputIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto move(InputIterator first, InputIterator last, OutputIterator result)
         -> detail::enable_if_t<
             not is_invocable_v<hide_adl::dummy_callable, InputIterator>,
@@ -65,6 +67,7 @@ namespace detail
     }
 
     template<typename InputIterator, typename OutputIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto move(InputIterator first, InputIterator last, OutputIterator result)
         -> detail::enable_if_t<
             is_invocable_v<hide_adl::dummy_callable, InputIterator>,
@@ -82,6 +85,7 @@ namespace detail
     // move_backward
 
     template<typename InputIterator, typename OutputIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto move_backward(InputIterator first, InputIterator last, OutputIterator result)
         -> detail::enable_if_t<
             not is_invocable_v<hide_adl::dummy_callable, InputIterator>,
@@ -92,6 +96,7 @@ namespace detail
     }
 
     template<typename InputIterator, typename OutputIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto move_backward(InputIterator first, InputIterator last, OutputIterator result)
         -> detail::enable_if_t<
             is_invocable_v<hide_adl::dummy_callable, InputIterator>,
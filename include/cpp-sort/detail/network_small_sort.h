@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_NETWORK_SMALL_SORT_H_
+#define CPPSORT_DETAIL_NETWORK_SMALL_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/adapters/small_collection_adapter.h>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorters/insertion_sorter.h>
+#include "config.h"
+#include "iterator_traits.h"
+#include "swap_if.h"
+#include "type_traits.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Base case of the quicksort-like and mergesort-like
+    // algorithms for small collections
+    //
+    // Insertion sort mispredicts about once per element on
+    // random data, while sorting networks are only made of
+    // compare-exchanges, which are branchless for arithmetic
+    // types sorted with std::less<> or std::greater<> and no
+    // projection. Sorting networks are only used in that case:
+    // branchful compare-exchanges are slower than insertion sort.
+
+    // Biggest collection sorted with a sorting network, bigger
+    // ones go through the regular algorithms and their thresholds
+    constexpr std::ptrdiff_t network_small_sort_max_size = CPPSORT_SORTING_NETWORK_THRESHOLD;
+    static_assert(network_small_sort_max_size >= 0 && network_small_sort_max_size <= 64,
+                  "CPPSORT_SORTING_NETWORK_THRESHOLD must be in the range [0, 64]");
+
+    template<typename Iterator, typename Compare, typename Projection>
+    using use_network_small_sort = std::integral_constant<bool,
+        std::is_base_of<
+            std::random_access_iterator_tag,
+            iterator_category_t<Iterator>
+        >::value &&
+        has_branchless_iter_swap_if<Iterator, Compare, Projection>::value
+    >;
+
+    using network_small_sorter = small_collection_adapter<
+        sorting_network_sorter,
+        insertion_sorter,
+        std::make_index_sequence<network_small_sort_max_size + 1>
+    >;
+
+    // Return whether the collection was sorted, the tag tells
+    // whether sorting networks can be used at all, which avoids
+    // instantiating them when they are not used
+
+    template<typename Iterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
+    auto network_small_sort(std::false_type, Iterator, Iterator, Compare, Projection)
+        -> bool
+    {
+        return false;
+    }
+
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
+    auto network_small_sort(std::true_type, RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare, Projection projection)
+        -> bool
+    {
+        // The jump table of small_collection_adapter can't be
+        // used in constant expressions, let insertion sort handle
+        // the small collections in that case
+        if (is_constant_evaluated() || last - first > network_small_sort_max_size) {
+            return false;
+        }
+        network_small_sorter{}(std::move(first), std::move(last),
+                               std::move(compare), std::move(projection));
+        return true;
+    }
+}}
+
+#endif // CPPSORT_DETAIL_NETWORK_SMALL_SORT_H_
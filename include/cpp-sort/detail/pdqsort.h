@@ -32,15 +32,18 @@
 #include <algorithm>
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/branchless_traits.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "bitops.h"
+#include "config.h"
 #include "heapsort.h"
 #include "insertion_sort.h"
 #include "iterator_traits.h"
 #include "iter_sort3.h"
+#include "network_small_sort.h"
 
 #ifdef __MINGW32__
 #   include <cstdint> // std::uintptr_t
@@ -53,10 +56,10 @@ namespace detail
     namespace pdqsort_detail {
         enum {
             // Partitions below this size are sorted using insertion sort.
-            insertion_sort_threshold = 24,
+            insertion_sort_threshold = CPPSORT_PDQSORT_INSERTION_SORT_THRESHOLD,
 
             // Partitions above this size use Tukey's ninther to select the pivot.
-            ninther_threshold = 128,
+            ninther_threshold = CPPSORT_PDQSORT_NINTHER_THRESHOLD,
 
             // When we detect an already sorted partition, attempt an insertion sort that allows this
             // amount of element moves before giving up.
@@ -72,6 +75,7 @@ namespace detail
         // Sorts [begin, end) using insertion sort with the given comparison function. Assumes
         // *(begin - 1) is an element smaller than or equal to any element in [begin, end).
         template<typename RandomAccessIterator, typename Compare, typename Projection>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto unguarded_insertion_sort(RandomAccessIterator begin, RandomAccessIterator end,
                                       Compare compare, Projection projection)
             -> void
@@ -105,6 +109,7 @@ namespace detail
         // partial_insertion_sort_limit elements were moved, and abort sorting. Otherwise it will
         // successfully sort and return true.
         template<typename RandomAccessIterator, typename Compare, typename Projection>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto partial_insertion_sort(RandomAccessIterator begin, RandomAccessIterator end,
                                     Compare compare, Projection projection)
             -> bool
@@ -155,6 +160,7 @@ namespace detail
 #endif
 
         template<typename RandomAccessIterator>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto swap_offsets(RandomAccessIterator first, RandomAccessIterator last,
                           unsigned char* offsets_l, unsigned char* offsets_r,
                           std::size_t num, bool use_swaps)
@@ -190,6 +196,7 @@ namespace detail
         // pivot is a median of at least 3 elements and that [begin, end) is at least
         // insertion_sort_threshold long. Uses branchless partitioning.
         template<typename RandomAccessIterator, typename Compare, typename Projection>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto partition_right_branchless(RandomAccessIterator begin, RandomAccessIterator end,
                                         Compare compare, Projection projection)
             -> std::pair<RandomAccessIterator, bool>
@@ -340,6 +347,7 @@ namespace detail
         // pivot is a median of at least 3 elements and that [begin, end) is at least
         // insertion_sort_threshold long.
         template<typename RandomAccessIterator, typename Compare, typename Projection>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto partition_right(RandomAccessIterator begin, RandomAccessIterator end,
                              Compare compare, Projection projection)
             -> std::pair<RandomAccessIterator, bool>
@@ -389,6 +397,7 @@ namespace detail
         // Similar function to the one above, except elements equal to the pivot are put to the left of
         // the pivot and it doesn't check or return if the passed sequence already was partitioned.
         template<typename RandomAccessIterator, typename Compare, typename Projection>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto partition_left(RandomAccessIterator begin, RandomAccessIterator end,
                             Compare compare, Projection projection)
             -> RandomAccessIterator
@@ -423,6 +432,7 @@ namespace detail
 
 
         template<typename RandomAccessIterator, typename Compare, typename Projection>
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto pdqsort_loop(RandomAccessIterator begin, RandomAccessIterator end,
                           Compare compare, Projection projection,
                           int bad_allowed, bool leftmost=true)
@@ -437,6 +447,8 @@ namespace detail
                 utility::is_probably_branchless_comparison_v<Compare, projected_type> &&
                 utility::is_probably_branchless_projection_v<Projection, value_type>;
 
+            using use_networks = use_network_small_sort<RandomAccessIterator, Compare, Projection>;
+
             auto&& comp = utility::as_function(compare);
             auto&& proj = utility::as_function(projection);
 
@@ -444,7 +456,11 @@ namespace detail
             while (true) {
                 difference_type size = end - begin;
 
-                // Insertion sort is faster for small arrays.
+                // Sorting networks are faster for small arrays when
+                // they are branchless, insertion sort otherwise.
+                if (network_small_sort(use_networks{}, begin, end, compare, projection)) {
+                    return;
+                }
                 if (size < insertion_sort_threshold) {
                     if (leftmost) {
                         insertion_sort(begin, end, std::move(compare), std::move(projection));
@@ -540,6 +556,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto pdqsort(RandomAccessIterator begin, RandomAccessIterator end,
                  Compare compare, Projection projection)
         -> void
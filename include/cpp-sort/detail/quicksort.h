@@ -14,9 +14,11 @@
 #include <cpp-sort/utility/iter_move.h>
 #include "bitops.h"
 #include "bubble_sort.h"
+#include "config.h"
 #include "insertion_sort.h"
 #include "introselect.h"
 #include "iterator_traits.h"
+#include "network_small_sort.h"
 #include "partition.h"
 
 namespace cppsort
@@ -33,7 +35,7 @@ namespace detail
                             std::forward_iterator_tag)
         -> bool
     {
-        if (size < 10) {
+        if (size < CPPSORT_QUICKSORT_BUBBLE_SORT_THRESHOLD) {
             bubble_sort(std::move(first), size,
                         std::move(compare), std::move(projection));
             return true;
@@ -48,7 +50,7 @@ namespace detail
                             std::bidirectional_iterator_tag)
         -> bool
     {
-        if (size < 42) {
+        if (size < CPPSORT_QUICKSORT_INSERTION_SORT_THRESHOLD) {
             insertion_sort(std::move(first), std::move(last),
                            std::move(compare), std::move(projection));
             return true;
@@ -56,6 +58,22 @@ namespace detail
         return false;
     }
 
+    template<typename RandomAccessIterator, typename Compare, typename Projection>
+    auto quicksort_fallback(RandomAccessIterator first, RandomAccessIterator last,
+                            difference_type_t<RandomAccessIterator> size,
+                            Compare compare, Projection projection,
+                            std::random_access_iterator_tag)
+        -> bool
+    {
+        using use_networks = use_network_small_sort<RandomAccessIterator, Compare, Projection>;
+        if (network_small_sort(use_networks{}, first, last, compare, projection)) {
+            return true;
+        }
+        return quicksort_fallback(std::move(first), std::move(last), size,
+                                  std::move(compare), std::move(projection),
+                                  std::bidirectional_iterator_tag{});
+    }
+
     template<typename ForwardIterator, typename Compare, typename Projection>
     auto quicksort(ForwardIterator first, ForwardIterator last,
                    difference_type_t<ForwardIterator> size, int bad_allowed,
@@ -0,0 +1,232 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_RANK_COUNTING_SORT_H_
+#define CPPSORT_DETAIL_RANK_COUNTING_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/utility/functional.h>
+#include "bitops.h"
+#include "iterator_traits.h"
+#include "pdqsort.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Counting sort over the ranks of the distinct values
+    //
+    // The occurrences of every distinct value are counted in a
+    // small hash table, then the distinct values are sorted and
+    // written back as many times as they were counted. The cost
+    // of the algorithm depends on the number of distinct values
+    // instead of the range of values, which makes it suitable
+    // for wide integer keys with a low cardinality.
+    //
+    // The cardinality is first estimated from the number of
+    // repeated values in an evenly spaced sample: the algorithm
+    // falls back to pdqsort when there are too few repetitions,
+    // or when the hash table grows too big while counting.
+
+    // Smallest collection sorted with rank_counting_sort,
+    // smaller collections are sorted with pdqsort
+    constexpr std::ptrdiff_t rank_counting_sort_min_size = 8192;
+
+    // Biggest number of elements used to estimate the cardinality
+    constexpr std::ptrdiff_t rank_counting_sort_max_sample_size = 4096;
+
+    // Biggest number of distinct values handled, past that size
+    // the hash table doesn't fit in the cache anymore
+    constexpr std::ptrdiff_t rank_counting_sort_max_distinct = 1 << 16;
+
+    template<typename Integer>
+    auto rank_counting_hash(Integer value, std::false_type)
+        -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(value);
+    }
+
+    template<typename Integer>
+    auto rank_counting_hash(Integer value, std::true_type)
+        -> std::uint64_t
+    {
+        // Fold the high bits of wide integers into the low ones
+        return static_cast<std::uint64_t>(value)
+             ^ static_cast<std::uint64_t>(value >> 64);
+    }
+
+    template<typename Integer>
+    auto rank_counting_hash(Integer value)
+        -> std::uint64_t
+    {
+        using is_wide = std::integral_constant<bool, (sizeof(Integer) > sizeof(std::uint64_t))>;
+        return rank_counting_hash(value, is_wide{});
+    }
+
+    template<typename Integer, typename Count>
+    struct rank_counting_entry
+    {
+        Integer value;
+        Count count;
+    };
+
+    template<typename Integer, typename Count>
+    class rank_counting_table
+    {
+        public:
+
+            using entry = rank_counting_entry<Integer, Count>;
+
+            rank_counting_table(std::size_t capacity, std::size_t max_distinct):
+                slots(capacity),
+                shift(64 - static_cast<int>(detail::log2(capacity))),
+                distinct(0),
+                max_distinct(max_distinct)
+            {}
+
+            auto add(Integer value)
+                -> bool
+            {
+                // Fibonacci hashing and linear probing, the slots
+                // with a count of zero are empty
+                auto mask = slots.size() - 1;
+                auto index = static_cast<std::size_t>(
+                    (rank_counting_hash(value) * 0x9E3779B97F4A7C15u) >> shift
+                );
+                while (slots[index].count != 0) {
+                    if (slots[index].value == value) {
+                        ++slots[index].count;
+                        return true;
+                    }
+                    index = (index + 1) & mask;
+                }
+                slots[index] = { value, 1 };
+
+                // Keep the load factor at or below 1/4 to keep the
+                // probe sequences short
+                if (++distinct > max_distinct) {
+                    return false;
+                }
+                if (distinct * 4 > slots.size()) {
+                    grow();
+                }
+                return true;
+            }
+
+            auto entries() &&
+                -> std::vector<entry>
+            {
+                auto last = std::remove_if(slots.begin(), slots.end(), [](const entry& e) {
+                    return e.count == 0;
+                });
+                slots.erase(last, slots.end());
+                return std::move(slots);
+            }
+
+        private:
+
+            auto grow()
+                -> void
+            {
+                rank_counting_table bigger(slots.size() * 2, max_distinct);
+                for (const auto& e: slots) {
+                    if (e.count != 0) {
+                        bigger.insert(e);
+                    }
+                }
+                using std::swap;
+                swap(slots, bigger.slots);
+                shift = bigger.shift;
+                distinct = bigger.distinct;
+            }
+
+            auto insert(const entry& e)
+                -> void
+            {
+                auto mask = slots.size() - 1;
+                auto index = static_cast<std::size_t>(
+                    (rank_counting_hash(e.value) * 0x9E3779B97F4A7C15u) >> shift
+                );
+                while (slots[index].count != 0) {
+                    index = (index + 1) & mask;
+                }
+                slots[index] = e;
+                ++distinct;
+            }
+
+            std::vector<entry> slots;
+            int shift;
+            std::size_t distinct;
+            std::size_t max_distinct;
+    };
+
+    template<typename RandomAccessIterator, typename Compare>
+    auto rank_counting_sort(RandomAccessIterator first, RandomAccessIterator last, Compare compare)
+        -> void
+    {
+        using value_type = value_type_t<RandomAccessIterator>;
+        using difference_type = difference_type_t<RandomAccessIterator>;
+
+        auto size = last - first;
+        if (size < rank_counting_sort_min_size) {
+            pdqsort(std::move(first), std::move(last), std::move(compare), utility::identity{});
+            return;
+        }
+
+        auto max_distinct = std::min<std::ptrdiff_t>(size / 8, rank_counting_sort_max_distinct);
+
+        // Estimate the number of distinct values: a sample of s
+        // values drawn among k distinct values contains roughly
+        // s*s/2k repeated values when k is big enough
+        auto sample_size = std::min<std::ptrdiff_t>(size / 8, rank_counting_sort_max_sample_size);
+        std::vector<value_type> sample;
+        sample.reserve(static_cast<std::size_t>(sample_size));
+        auto stride = size / sample_size;
+        for (std::ptrdiff_t i = 0 ; i < sample_size ; ++i) {
+            sample.push_back(first[static_cast<difference_type>(i * stride)]);
+        }
+        pdqsort(sample.begin(), sample.end(), std::less<>{}, utility::identity{});
+        auto sample_distinct = std::unique(sample.begin(), sample.end()) - sample.begin();
+        auto repeats = sample_size - sample_distinct;
+        if (2 * repeats * max_distinct < sample_size * sample_size) {
+            pdqsort(std::move(first), std::move(last), std::move(compare), utility::identity{});
+            return;
+        }
+
+        // Count the occurrences of every distinct value, give up
+        // when there are too many of them
+        rank_counting_table<value_type, difference_type> table(
+            detail::hyperceil<std::size_t>(8 * static_cast<std::size_t>(sample_distinct)),
+            static_cast<std::size_t>(max_distinct)
+        );
+        for (auto it = first ; it != last ; ++it) {
+            if (not table.add(*it)) {
+                pdqsort(std::move(first), std::move(last), std::move(compare), utility::identity{});
+                return;
+            }
+        }
+
+        // Sort the dictionary of distinct values, the position of
+        // a value in the dictionary is its rank
+        using entry = typename rank_counting_table<value_type, difference_type>::entry;
+        auto dictionary = std::move(table).entries();
+        pdqsort(dictionary.begin(), dictionary.end(), std::move(compare), &entry::value);
+
+        for (const auto& e: dictionary) {
+            first = std::fill_n(first, e.count, e.value);
+        }
+    }
+}}
+
+#endif // CPPSORT_DETAIL_RANK_COUNTING_SORT_H_
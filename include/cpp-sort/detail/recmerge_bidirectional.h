@@ -23,6 +23,7 @@
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "buffered_inplace_merge.h"
+#include "config.h"
 #include "iterator_traits.h"
 #include "lower_bound.h"
 #include "rotate.h"
@@ -37,6 +38,7 @@ namespace detail
 
     template<typename BidirectionalIterator, typename RandomAccessIterator,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto recmerge(BidirectionalIterator first, BidirectionalIterator middle,
                   BidirectionalIterator last,
                   Compare compare, Projection projection,
@@ -51,8 +53,8 @@ namespace detail
         auto&& proj = utility::as_function(projection);
 
         while (true) {
-            // if middle == last, we're done
-            if (len2 == 0)
+            // if first == middle or middle == last, we're done
+            if (len1 == 0 || len2 == 0)
                 return;
             if (len1 <= buff_size || len2 <= buff_size) {
                 buffered_inplace_merge(first, middle, last,
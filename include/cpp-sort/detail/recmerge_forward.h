@@ -31,6 +31,7 @@
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "buffered_inplace_merge.h"
+#include "config.h"
 #include "iterator_traits.h"
 #include "lower_bound.h"
 #include "memory.h"
@@ -47,6 +48,7 @@ namespace detail
     // recmerge for forward iterators
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_n_step_0(ForwardIterator f0, difference_type_t<ForwardIterator> n0,
                         ForwardIterator f1, difference_type_t<ForwardIterator> n1,
                         Compare compare, Projection projection,
@@ -70,6 +72,7 @@ namespace detail
     }
 
     template<typename ForwardIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto merge_n_step_1(ForwardIterator f0, difference_type_t<ForwardIterator> n0,
                         ForwardIterator f1, difference_type_t<ForwardIterator> n1,
                         Compare compare, Projection projection,
@@ -92,8 +95,35 @@ namespace detail
         n1_1 = n1 - n0_1 - 1;
     }
 
+    // Merge through the buffer when the first partition fits in it,
+    // out of recmerge to keep the latter usable in constant expressions
+
     template<typename ForwardIterator, typename RandomAccessIterator,
              typename Compare, typename Projection>
+    auto buffered_recmerge(ForwardIterator f0, difference_type_t<ForwardIterator> n0,
+                           ForwardIterator f1, difference_type_t<ForwardIterator> n1,
+                           RandomAccessIterator buffer,
+                           Compare compare, Projection projection)
+        -> void
+    {
+        using rvalue_type = rvalue_type_t<ForwardIterator>;
+
+        destruct_n<rvalue_type> d(0);
+        std::unique_ptr<
+            rvalue_type,
+            destruct_n<rvalue_type>&
+        > h2(buffer, d);
+        auto buff_ptr = uninitialized_move(f0, f1, buffer, d);
+
+        half_inplace_merge(
+            buffer, buff_ptr, f1, std::next(f1, n1), f0,
+            n0, std::move(compare), std::move(projection)
+        );
+    }
+
+    template<typename ForwardIterator, typename RandomAccessIterator,
+             typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto recmerge(ForwardIterator f0, difference_type_t<ForwardIterator> n0,
                   ForwardIterator f1, difference_type_t<ForwardIterator> n1,
                   RandomAccessIterator buffer, std::ptrdiff_t buff_size,
@@ -101,23 +131,13 @@ namespace detail
                   std::forward_iterator_tag tag)
         -> void
     {
-        using rvalue_type = rvalue_type_t<ForwardIterator>;
         using difference_type = difference_type_t<ForwardIterator>;
 
         if (n0 == 0 || n1 == 0) return;
 
         if (n0 <= buff_size) {
-            destruct_n<rvalue_type> d(0);
-            std::unique_ptr<
-                rvalue_type,
-                destruct_n<rvalue_type>&
-            > h2(buffer, d);
-            auto buff_ptr = uninitialized_move(f0, f1, buffer, d);
-
-            half_inplace_merge(
-                buffer, buff_ptr, f1, std::next(f1, n1), f0,
-                n0, std::move(compare), std::move(projection)
-            );
+            buffered_recmerge(std::move(f0), n0, std::move(f1), n1, buffer,
+                              std::move(compare), std::move(projection));
             return;
         }
 
@@ -21,6 +21,7 @@
 #include <type_traits>
 #include <utility>
 #include <cpp-sort/utility/iter_move.h>
+#include "config.h"
 #include "iterator_traits.h"
 #include "move.h"
 #include "swap_ranges.h"
@@ -30,6 +31,7 @@ namespace cppsort
 namespace detail
 {
     template<typename ForwardIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_left(ForwardIterator first, ForwardIterator last)
         -> ForwardIterator
     {
@@ -42,6 +44,7 @@ namespace detail
     }
 
     template<typename BidirectionalIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_right(BidirectionalIterator first, BidirectionalIterator last)
         -> BidirectionalIterator
     {
@@ -55,6 +58,7 @@ namespace detail
     }
 
     template<typename ForwardIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_forward(ForwardIterator first, ForwardIterator middle, ForwardIterator last)
         -> ForwardIterator
     {
@@ -92,6 +96,7 @@ namespace detail
     }
 
     template<typename Integral>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto gcd(Integral x, Integral y)
         -> Integral
     {
@@ -105,6 +110,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_gcd(RandomAccessIterator first, RandomAccessIterator middle,
                     RandomAccessIterator last)
         -> RandomAccessIterator
@@ -141,6 +147,7 @@ namespace detail
     }
 
     template<typename ForwardIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_impl(ForwardIterator first, ForwardIterator middle, ForwardIterator last,
                      std::forward_iterator_tag)
         -> ForwardIterator
@@ -155,6 +162,7 @@ namespace detail
     }
 
     template<typename BidirectionalIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_impl(BidirectionalIterator first, BidirectionalIterator middle, BidirectionalIterator last,
                      std::bidirectional_iterator_tag)
         -> BidirectionalIterator
@@ -171,6 +179,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate_impl(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last,
                      std::random_access_iterator_tag)
         -> RandomAccessIterator
@@ -188,6 +197,7 @@ namespace detail
     }
 
     template<typename ForwardIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto rotate(ForwardIterator first, ForwardIterator middle, ForwardIterator last)
         -> ForwardIterator
     {
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_SCRATCH_BUFFER_H_
+#define CPPSORT_DETAIL_SCRATCH_BUFFER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include "memory.h"
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Per-thread raw memory kept alive between sorts
+    //
+    // The memory is only ever grown, and is released when the
+    // thread that owns it exits. It never grows past the size
+    // below so that a single big sort doesn't keep its memory
+    // alive for the rest of the thread
+
+    constexpr std::size_t thread_scratch_max_size = 1024 * 1024;
+
+    struct thread_scratch_memory
+    {
+        void* memory = nullptr;
+        std::size_t size = 0;
+        std::size_t alignment = 0;
+        bool in_use = false;
+
+        thread_scratch_memory() = default;
+        thread_scratch_memory(const thread_scratch_memory&) = delete;
+        thread_scratch_memory& operator=(const thread_scratch_memory&) = delete;
+
+        ~thread_scratch_memory()
+        {
+            deallocate(memory, size, alignment);
+        }
+
+        static auto allocate(std::size_t size, std::size_t alignment)
+            -> void*
+        {
+#ifdef __cpp_aligned_new
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+                return ::operator new(size, std::align_val_t(alignment));
+            }
+#endif
+            (void) alignment;
+            return ::operator new(size);
+        }
+
+        static auto deallocate(void* memory, std::size_t size, std::size_t alignment) noexcept
+            -> void
+        {
+#ifdef __cpp_aligned_new
+            if (alignment > __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+#   ifdef __cpp_sized_deallocation
+                ::operator delete(memory, size, std::align_val_t(alignment));
+#   else
+                ::operator delete(memory, std::align_val_t(alignment));
+#   endif
+                return;
+            }
+#endif
+            (void) alignment;
+            operator_deleter{size}(memory);
+        }
+    };
+
+    // The thread-local memory is a static data member of a class
+    // template so that it can be defined in a header without an
+    // inline accessor function
+
+    template<typename=void>
+    struct thread_scratch_storage
+    {
+        static thread_local thread_scratch_memory scratch;
+    };
+
+    template<typename Dummy>
+    thread_local thread_scratch_memory thread_scratch_storage<Dummy>::scratch;
+
+    ////////////////////////////////////////////////////////////
+    // Whether a scratch buffer can hold objects of type T:
+    // over-aligned types need the aligned allocation functions
+    // introduced in C++17
+
+    template<typename T>
+    using can_use_scratch_buffer = std::integral_constant<bool,
+        std::is_trivially_copyable<T>::value &&
+#ifdef __cpp_aligned_new
+        true
+#else
+        alignof(T) <= alignof(std::max_align_t)
+#endif
+    >;
+
+    ////////////////////////////////////////////////////////////
+    // Scratch buffer
+    //
+    // Uninitialized storage for a given number of trivially
+    // copyable objects: it borrows the memory of the current
+    // thread when it is available, and otherwise - when scratch
+    // buffers are nested or when the requested size is bigger
+    // than the memory kept between sorts - it falls back to a
+    // dedicated allocation
+
+    template<typename T>
+    class scratch_buffer
+    {
+        static_assert(can_use_scratch_buffer<T>::value,
+                      "scratch_buffer can only store trivially copyable types "
+                      "that can be allocated with the required alignment");
+
+        public:
+
+            scratch_buffer(const scratch_buffer&) = delete;
+            scratch_buffer& operator=(const scratch_buffer&) = delete;
+
+            ////////////////////////////////////////////////////////////
+            // Construction
+
+            explicit scratch_buffer(std::ptrdiff_t n):
+                scratch_(&thread_scratch_storage<>::scratch)
+            {
+                auto bytes = static_cast<std::size_t>(n) * sizeof(T);
+                if (scratch_->in_use || bytes > thread_scratch_max_size) {
+                    // The thread memory is already borrowed or
+                    // too small to be grown to the needed size
+                    scratch_ = nullptr;
+                    memory_ = static_cast<T*>(thread_scratch_memory::allocate(bytes, alignof(T)));
+                    size_ = bytes;
+                    return;
+                }
+
+                if (scratch_->size < bytes || scratch_->alignment < alignof(T)) {
+                    // Grow the thread memory, the old content
+                    // doesn't matter so it isn't copied
+                    auto alignment = scratch_->alignment < alignof(T) ? alignof(T) : scratch_->alignment;
+                    thread_scratch_memory::deallocate(scratch_->memory, scratch_->size,
+                                                      scratch_->alignment);
+                    scratch_->memory = nullptr;
+                    scratch_->size = 0;
+                    scratch_->alignment = 0;
+                    scratch_->memory = thread_scratch_memory::allocate(bytes, alignment);
+                    scratch_->size = bytes;
+                    scratch_->alignment = alignment;
+                }
+                scratch_->in_use = true;
+                memory_ = static_cast<T*>(scratch_->memory);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Destruction
+
+            ~scratch_buffer()
+            {
+                if (scratch_) {
+                    scratch_->in_use = false;
+                } else {
+                    thread_scratch_memory::deallocate(memory_, size_, alignof(T));
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Element access
+
+            auto data() const noexcept
+                -> T*
+            {
+                return memory_;
+            }
+
+        private:
+
+            thread_scratch_memory* scratch_;
+            T* memory_ = nullptr;
+            std::size_t size_ = 0;
+    };
+}}
+
+#endif // CPPSORT_DETAIL_SCRATCH_BUFFER_H_
@@ -27,6 +27,7 @@
 #include <cpp-sort/utility/as_function.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "attributes.h"
+#include "config.h"
 #include "iterator_traits.h"
 #include "memcpy_cast.h"
 #include "pdqsort.h"
@@ -983,8 +984,10 @@ namespace detail
                   Projection projection)
         -> void
     {
-        detail::inplace_radix_sort<128, 1024>(std::move(begin), std::move(end),
-                                              std::move(projection));
+        detail::inplace_radix_sort<
+            CPPSORT_SKA_SORT_PDQSORT_THRESHOLD,
+            CPPSORT_SKA_SORT_AMERICAN_FLAG_SORT_THRESHOLD
+        >(std::move(begin), std::move(end), std::move(projection));
     }
 
     ////////////////////////////////////////////////////////////
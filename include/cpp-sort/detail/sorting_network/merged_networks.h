@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_DETAIL_SORTING_NETWORK_MERGED_NETWORKS_H_
+#define CPPSORT_DETAIL_SORTING_NETWORK_MERGED_NETWORKS_H_
+
+namespace cppsort
+{
+namespace detail
+{
+    ////////////////////////////////////////////////////////////
+    // Sorting networks for 33 thru 64 inputs
+    //
+    // No size-optimal network is hardcoded for those sizes:
+    // instead the inputs are split in two parts sorted with the
+    // networks above, which are then merged with Batcher's
+    // odd-even merge. The split minimizing the total number of
+    // compare-exchanges is picked at compile time, and the index
+    // pairs of the resulting network are ordered by layer so that
+    // the compare-exchanges of both parts are interleaved.
+
+    template<std::size_t... Indices>
+    constexpr auto hardcoded_network_size(std::size_t n, std::index_sequence<Indices...>)
+        -> std::size_t
+    {
+        constexpr std::size_t sizes[] = {
+            sorting_network_sorter_impl<Indices>::template index_pairs<>().size()...
+        };
+        return sizes[n];
+    }
+
+    constexpr auto merged_network_size(std::size_t first_size, std::size_t second_size)
+        -> std::size_t
+    {
+        using indices = std::make_index_sequence<33>;
+        return hardcoded_network_size(first_size, indices{})
+             + hardcoded_network_size(second_size, indices{})
+             + utility::detail::odd_even_merge_runs_network(first_size, second_size, nullptr);
+    }
+
+    // Size of the first part of the network
+    constexpr auto merged_network_split(std::size_t n)
+        -> std::size_t
+    {
+        std::size_t res = n / 2;
+        for (auto split = n - 32 ; split <= 32 ; ++split) {
+            if (merged_network_size(split, n - split) < merged_network_size(res, n - res)) {
+                res = split;
+            }
+        }
+        return res;
+    }
+
+    template<std::size_t N>
+    struct merged_sorting_network_sorter_impl
+    {
+        static_assert(
+            N > 32 && N <= 64,
+            "sorting_network_sorter has no specialization for this size of N"
+        );
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare = std::less<>,
+            typename Projection = utility::identity,
+            typename = detail::enable_if_t<is_projection_iterator_v<
+                Projection, RandomAccessIterator, Compare
+            >>
+        >
+        CPPSORT_CONSTEXPR_AFTER_CXX17
+        auto operator()(RandomAccessIterator first, RandomAccessIterator,
+                        Compare compare={}, Projection projection={}) const
+            -> void
+        {
+            // Unrolling networks of that size generally results in
+            // register spills, a loop over the pairs is faster
+            using difference_type = difference_type_t<RandomAccessIterator>;
+            constexpr auto pairs = index_pairs<difference_type>();
+            utility::swap_index_pairs(first, pairs, std::move(compare), std::move(projection));
+        }
+
+        template<typename DifferenceType=std::ptrdiff_t>
+        static constexpr auto index_pairs()
+            -> std::array<
+                utility::index_pair<DifferenceType>,
+                merged_network_size(merged_network_split(N), N - merged_network_split(N))
+            >
+        {
+            constexpr std::size_t first_size = merged_network_split(N);
+            constexpr std::size_t second_size = N - first_size;
+            constexpr std::size_t size = merged_network_size(first_size, second_size);
+            constexpr auto first_pairs = sorting_network_sorter_impl<first_size>::template index_pairs<>();
+            constexpr auto second_pairs = sorting_network_sorter_impl<second_size>::template index_pairs<>();
+
+            utility::detail::raw_index_pair pairs[size] = {};
+            std::size_t pos = 0;
+            for (std::size_t i = 0 ; i < first_pairs.size() ; ++i) {
+                pairs[pos] = first_pairs[i];
+                ++pos;
+            }
+            for (std::size_t i = 0 ; i < second_pairs.size() ; ++i) {
+                pairs[pos] = {
+                    second_pairs[i].first + static_cast<std::ptrdiff_t>(first_size),
+                    second_pairs[i].second + static_cast<std::ptrdiff_t>(first_size)
+                };
+                ++pos;
+            }
+            utility::detail::odd_even_merge_runs_network(first_size, second_size, pairs + pos);
+
+            return utility::detail::order_by_layer<DifferenceType, N, size>(pairs);
+        }
+    };
+}}
+
+#endif // CPPSORT_DETAIL_SORTING_NETWORK_MERGED_NETWORKS_H_
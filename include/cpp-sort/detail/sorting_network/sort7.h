@@ -20,6 +20,7 @@ namespace detail
                 Projection, RandomAccessIterator, Compare
             >>
         >
+        CPPSORT_CONSTEXPR_AFTER_CXX17
         auto operator()(RandomAccessIterator first, RandomAccessIterator,
                         Compare compare={}, Projection projection={}) const
             -> void
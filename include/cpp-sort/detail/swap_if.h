@@ -16,6 +16,7 @@
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "config.h"
+#include "iterator_traits.h"
 #include "type_traits.h"
 
 namespace cppsort
@@ -26,6 +27,7 @@ namespace detail
     // swap_if
 
     template<typename T, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(T& lhs, T& rhs, Compare compare, Projection projection)
         -> void
     {
@@ -39,6 +41,7 @@ namespace detail
     }
 
     template<typename T>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(T& lhs, T& rhs)
         noexcept(noexcept(swap_if(lhs, rhs, std::less<>{}, utility::identity{})))
         -> void
@@ -46,16 +49,26 @@ namespace detail
         swap_if(lhs, rhs, std::less<>{}, utility::identity{});
     }
 
+    // The integer versions build a mask from the result of the
+    // comparison instead of relying on min/max: compilers tend to
+    // turn the latter back into branches in big sorting networks
+
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::less<>, utility::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
-        Integer dx = x;
-        x = (std::min)(x, y);
-        y ^= dx ^ x;
+        using unsigned_t = std::make_unsigned_t<std::common_type_t<Integer, int>>;
+        auto mask = static_cast<unsigned_t>(0) - static_cast<unsigned_t>(y < x);
+        auto diff = static_cast<Integer>(
+            (static_cast<unsigned_t>(x) ^ static_cast<unsigned_t>(y)) & mask
+        );
+        x ^= diff;
+        y ^= diff;
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::less<>, utility::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -65,15 +78,21 @@ namespace detail
     }
 
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::greater<>, utility::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
-        Integer dx = x;
-        x = (std::max)(x, y);
-        y ^= dx ^ x;
+        using unsigned_t = std::make_unsigned_t<std::common_type_t<Integer, int>>;
+        auto mask = static_cast<unsigned_t>(0) - static_cast<unsigned_t>(x < y);
+        auto diff = static_cast<Integer>(
+            (static_cast<unsigned_t>(x) ^ static_cast<unsigned_t>(y)) & mask
+        );
+        x ^= diff;
+        y ^= diff;
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::greater<>, utility::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -84,6 +103,7 @@ namespace detail
 
 #if CPPSORT_STD_IDENTITY_AVAILABLE
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::less<> comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
@@ -91,6 +111,7 @@ namespace detail
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::less<> comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -98,6 +119,7 @@ namespace detail
     }
 
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::greater<> comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
@@ -105,6 +127,7 @@ namespace detail
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::greater<> comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -114,6 +137,7 @@ namespace detail
 
 #ifdef __cpp_lib_ranges
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::ranges::less comp, utility::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
@@ -121,6 +145,7 @@ namespace detail
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::ranges::less comp, utility::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -128,6 +153,7 @@ namespace detail
     }
 
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::ranges::greater comp, utility::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
@@ -135,6 +161,7 @@ namespace detail
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::ranges::greater comp, utility::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -142,6 +169,7 @@ namespace detail
     }
 
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::ranges::less comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
@@ -149,6 +177,7 @@ namespace detail
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::ranges::less comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -156,6 +185,7 @@ namespace detail
     }
 
     template<typename Integer>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Integer& x, Integer& y, std::ranges::greater comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_integral<Integer>::value>
     {
@@ -163,6 +193,7 @@ namespace detail
     }
 
     template<typename Float>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_if(Float& x, Float& y, std::ranges::greater comp, std::identity) noexcept
         -> detail::enable_if_t<std::is_floating_point<Float>::value>
     {
@@ -170,6 +201,61 @@ namespace detail
     }
 #endif
 
+    ////////////////////////////////////////////////////////////
+    // Whether swap_if is branchless for the given parameters:
+    // the overloads above are the only noexcept ones
+
+    template<typename T, typename Compare, typename Projection>
+    using has_branchless_swap_if = std::integral_constant<bool,
+        noexcept(swap_if(std::declval<T&>(), std::declval<T&>(),
+                         std::declval<Compare>(), std::declval<Projection>()))
+    >;
+
+    ////////////////////////////////////////////////////////////
+    // Whether an iterator has a dedicated ADL-found iter_swap
+    //
+    // ADL finds std::iter_swap for every iterator that has std
+    // among its associated namespaces, such as the iterators of
+    // std::vector, which is not a reason to avoid the swap_if
+    // optimizations. The overload below is more specialized than
+    // std::iter_swap and less specialized than any overload that
+    // is actually dedicated to a given iterator type, so it is
+    // only picked when no such overload exists.
+
+    namespace iter_swap_lookup
+    {
+        struct not_dedicated {};
+
+        template<typename Iterator>
+        auto iter_swap(Iterator, Iterator)
+            -> not_dedicated;
+
+        template<typename Iterator>
+        using iter_swap_t = decltype(iter_swap(
+            std::declval<Iterator&>(), std::declval<Iterator&>())
+        );
+    }
+
+    template<typename Iterator>
+    using has_dedicated_iter_swap = negation<std::is_same<
+        detected_t<iter_swap_lookup::iter_swap_t, Iterator>,
+        iter_swap_lookup::not_dedicated
+    >>;
+
+    ////////////////////////////////////////////////////////////
+    // Whether iter_swap_if can call swap_if on the pointed
+    // elements: the iterators must not have dedicated iter_move
+    // or iter_swap ADL-found functions, and must return actual
+    // references, which excludes proxy iterators such as the
+    // ones of std::vector<bool>
+
+    template<typename Iterator>
+    using can_iter_swap_if_with_swap_if = std::integral_constant<bool,
+        not is_detected_v<utility::detail::has_iter_move_t, Iterator> &&
+        not has_dedicated_iter_swap<Iterator>::value &&
+        std::is_lvalue_reference<reference_t<Iterator>>::value
+    >;
+
     ////////////////////////////////////////////////////////////
     // iter_swap_if
 
@@ -178,10 +264,10 @@ namespace detail
         typename Compare,
         typename Projection,
         typename = detail::enable_if_t<
-            is_detected_v<utility::detail::has_iter_move_t, Iterator> ||
-            is_detected_v<utility::detail::has_iter_swap_t, Iterator>
+            not can_iter_swap_if_with_swap_if<Iterator>::value
         >
     >
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto iter_swap_if(Iterator lhs, Iterator rhs, Compare compare, Projection projection)
         -> void
     {
@@ -199,21 +285,31 @@ namespace detail
         typename Compare,
         typename Projection,
         typename = detail::enable_if_t<
-            not is_detected_v<utility::detail::has_iter_move_t, Iterator> &&
-            not is_detected_v<utility::detail::has_iter_swap_t, Iterator>
+            can_iter_swap_if_with_swap_if<Iterator>::value
         >,
         typename = void // dummy parameter for ODR
     >
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto iter_swap_if(Iterator lhs, Iterator rhs, Compare compare, Projection projection)
         noexcept(noexcept(swap_if(*lhs, *rhs, std::move(compare), std::move(projection))))
         -> void
     {
         // Take advantage of the swap_if optimizations
         // only when the iterators don't have dedicated
-        // iter_move or iter_swap ADL-found functions
+        // iter_move or iter_swap ADL-found functions,
+        // and when they return actual references
 
         swap_if(*lhs, *rhs, std::move(compare), std::move(projection));
     }
+
+    ////////////////////////////////////////////////////////////
+    // Whether iter_swap_if is branchless for the given parameters
+
+    template<typename Iterator, typename Compare, typename Projection>
+    using has_branchless_iter_swap_if = std::integral_constant<bool,
+        can_iter_swap_if_with_swap_if<Iterator>::value &&
+        has_branchless_swap_if<std::remove_reference_t<reference_t<Iterator>>, Compare, Projection>::value
+    >;
 }}
 
 #endif // CPPSORT_DETAIL_SWAP_IF_H_
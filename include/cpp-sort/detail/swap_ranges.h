@@ -28,6 +28,7 @@ namespace detail
     // library's algorithms to work
 
     template<typename ForwardIterator1, typename ForwardIterator2>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_ranges_overlap(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2)
         -> ForwardIterator2
     {
@@ -49,6 +50,7 @@ namespace detail
     // additional diagnostics when the precondition is violated
 
     template<typename ForwardIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_ranges_inner_impl(std::forward_iterator_tag,
                                 ForwardIterator first1, ForwardIterator last1,
                                 ForwardIterator first2)
@@ -72,6 +74,7 @@ namespace detail
     }
 
     template<typename RandomAccessIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_ranges_inner_impl(std::random_access_iterator_tag,
                                 RandomAccessIterator first1, RandomAccessIterator last1,
                                 RandomAccessIterator first2)
@@ -88,6 +91,7 @@ namespace detail
     }
 
     template<typename ForwardIterator>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_ranges_inner(ForwardIterator first1, ForwardIterator last1, ForwardIterator first2)
         -> ForwardIterator
     {
@@ -12,6 +12,7 @@
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include "buffered_inplace_merge.h"
+#include "config.h"
 #include "iterator_traits.h"
 #include "rotate.h"
 #include "type_traits.h"
@@ -24,6 +25,7 @@ namespace detail
     // Random-access algorithm using symmerge
 
     template<typename RandomAccessIterator, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto symmerge_bsearch(RandomAccessIterator arr,
                           difference_type_t<RandomAccessIterator> l,
                           difference_type_t<RandomAccessIterator> r,
@@ -47,6 +49,7 @@ namespace detail
 
     template<typename RandomAccessIterator1, typename RandomAccessIterator2,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto symmerge(RandomAccessIterator1 arr,
                   difference_type_t<RandomAccessIterator1> first,
                   difference_type_t<RandomAccessIterator1> middle,
@@ -257,6 +257,21 @@ namespace detail
     template<typename T>
     constexpr bool is_bounded_array_v = is_bounded_array<T>::value;
 
+    ////////////////////////////////////////////////////////////
+    // std::is_constant_evaluated from C++20, always false when
+    // it isn't available since the algorithms can't be evaluated
+    // at compile time anyway in that case
+
+    constexpr auto is_constant_evaluated() noexcept
+        -> bool
+    {
+#ifdef __cpp_lib_is_constant_evaluated
+        return std::is_constant_evaluated();
+#else
+        return false;
+#endif
+    }
+
     ////////////////////////////////////////////////////////////
     // Type traits to take __int128 into account even when the
     // standard library isn't instrumented but the type is still
@@ -329,6 +344,24 @@ namespace detail
     template<typename T, template<typename...> class Template>
     constexpr bool is_specialization_of_v = is_specialization_of<T, Template>::value;
 
+    ////////////////////////////////////////////////////////////
+    // has_domain: whether the traits of a fixed-size sorter
+    // provide the domain of sizes it works with
+
+    template<typename T, typename=void>
+    struct has_domain:
+        std::false_type
+    {
+        using domain = void;
+    };
+
+    template<typename T>
+    struct has_domain<T, void_t<typename T::domain>>:
+        std::true_type
+    {
+        using domain = typename T::domain;
+    };
+
     ////////////////////////////////////////////////////////////
     // is_in_pack: check whether a given std::size_t value
     // appears in a std::size_t... parameter pack
@@ -12,6 +12,7 @@
 #include <utility>
 #include <cpp-sort/utility/as_function.h>
 #include "bitops.h"
+#include "config.h"
 #include "iterator_traits.h"
 
 namespace cppsort
@@ -20,6 +21,7 @@ namespace detail
 {
     template<typename ForwardIterator, typename T,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto upper_bound_n(ForwardIterator first, difference_type_t<ForwardIterator> size,
                        T&& value, Compare compare, Projection projection)
         -> ForwardIterator
@@ -42,6 +44,7 @@ namespace detail
 
     template<typename ForwardIterator, typename T,
              typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto upper_bound(ForwardIterator first, ForwardIterator last, T&& value,
                      Compare compare, Projection projection)
         -> ForwardIterator
@@ -8,9 +8,12 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstdint>
 #include <iterator>
-#include <list>
+#include <limits>
 #include <utility>
+#include <vector>
 #include <cpp-sort/adapters/stable_adapter.h>
 #include <cpp-sort/sorters/pdq_sorter.h>
 #include <cpp-sort/sorters/quick_merge_sorter.h>
@@ -20,6 +23,7 @@
 #include "inplace_merge.h"
 #include "iterator_traits.h"
 #include "lower_bound.h"
+#include "memory.h"
 #include "quick_merge_sort.h"
 #include "reverse.h"
 #include "rotate.h"
@@ -44,52 +48,154 @@ namespace verge
     };
 
     ////////////////////////////////////////////////////////////
-    // Merge a list of runs with a k-way merge
+    // Merge two adjacent runs, with a micro-optimization for
+    // runs of size 1 because it can happen, and the generic
+    // inplace_merge algorithm cares not
+
+    template<typename BidirectionalIterator, typename Compare, typename Projection, typename T>
+    auto merge_adjacent_runs(BidirectionalIterator begin, BidirectionalIterator middle,
+                             BidirectionalIterator end,
+                             difference_type_t<BidirectionalIterator> size_left,
+                             difference_type_t<BidirectionalIterator> size_right,
+                             temporary_buffer<T>& buffer,
+                             Compare compare, Projection projection)
+        -> void
+    {
+        auto&& comp = utility::as_function(compare);
+        auto&& proj = utility::as_function(projection);
+
+        if (size_left == 1) {
+            auto&& target = proj(*begin);
+            if (comp(proj(*middle), target)) {
+                auto insert_it = detail::lower_bound_n(middle, size_right, target, compare, projection);
+                detail::rotate_left(begin, insert_it);
+            }
+        } else if (size_right == 1) {
+            auto&& target = proj(*std::prev(end));
+            if (comp(target, proj(*std::prev(middle)))) {
+                auto insert_it = detail::upper_bound_n(begin, size_left, target, compare, projection);
+                detail::rotate_right(insert_it, end);
+            }
+        } else {
+            // The buffer is shared by all the merges and only grows
+            // when a merge needs more memory than it currently holds
+            auto needed = (std::min)(size_left, size_right);
+            if (buffer.size() < needed) {
+                buffer.try_grow(needed);
+            }
+            detail::inplace_merge(begin, middle, end, compare, projection,
+                                  size_left, size_right, buffer.data(), buffer.size());
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Node power of the boundary between two adjacent runs as
+    // described in *Nearly-Optimal Mergesorts* by J. Ian Munro
+    // and Sebastian Wild: the first run starts at the position
+    // begin_left and both runs are part of a collection of the
+    // given size
+
+    inline auto node_power(std::uintmax_t size, std::uintmax_t begin_left,
+                           std::uintmax_t size_left, std::uintmax_t size_right)
+        -> int
+    {
+        // Twice the midpoints of both runs, relative to twice the
+        // size: the power is the position of the first bit that
+        // differs in the binary expansions of the normalized
+        // midpoints, which are computed one bit at a time
+        std::uintmax_t twice_size = 2 * size;
+        std::uintmax_t a = 2 * begin_left + size_left;
+        std::uintmax_t b = a + size_left + size_right;
+
+        int power = 0;
+        while (true) {
+            ++power;
+            a *= 2;
+            b *= 2;
+            if (a >= twice_size) {
+                a -= twice_size;
+                b -= twice_size;
+            } else if (b >= twice_size) {
+                break;
+            }
+        }
+        return power;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Merge an array of runs following the powersort merge
+    // policy: the runs are merged in a nearly-optimal order
+    // with regard to the sizes of the runs, which limits the
+    // number of times every element is moved around
 
     template<typename BidirectionalIterator, typename Compare, typename Projection>
-    auto merge_runs(BidirectionalIterator first, std::list<verge::run<BidirectionalIterator>>& runs,
+    auto merge_runs(BidirectionalIterator first, difference_type_t<BidirectionalIterator> size,
+                    const std::vector<verge::run<BidirectionalIterator>>& runs,
                     Compare compare, Projection projection)
         -> void
     {
         if (runs.size() < 2) return;
 
-        auto&& comp = utility::as_function(compare);
-        auto&& proj = utility::as_function(projection);
-
-        // Merge runs pairwise until there are no runs left
-        do {
-            auto begin = first;
-            for (auto it = runs.begin() ; it != runs.end() && it != std::prev(runs.end()) ; ++it) {
-                auto next_it = std::next(it);
-
-                // Merge the runs, micro-optimize for size 1 because it can happen,
-                // and the generic inplace_merge algorithm cares not
-                if (it->size == 1) {
-                    auto&& target = proj(*begin);
-                    if (comp(proj(*it->end), target)) {
-                        auto insert_it = detail::lower_bound_n(it->end, next_it->size, target, compare, projection);
-                        detail::rotate_left(first, insert_it);
-                    } else {
-                    }
-                } else if (next_it->size == 1) {
-                    auto&& target = proj(*std::prev(next_it->end));
-                    if (comp(target, proj(*std::prev(it->end)))) {
-                        auto insert_it = detail::upper_bound_n(begin, it->size, target, compare, projection);
-                        detail::rotate_right(insert_it, next_it->end);
-                    }
-                } else {
-                    detail::inplace_merge(begin, it->end, next_it->end, compare, projection,
-                                          it->size, next_it->size);
-                }
+        using difference_type = difference_type_t<BidirectionalIterator>;
 
-                // Compute the size of the new merged run
-                next_it->size += it->size;
-                // Remove the middle iterator to order to fuse the two
-                // consecutive runs, and advance to the next pair
-                it = runs.erase(it);
-                begin = it->end;
+        struct stack_entry
+        {
+            BidirectionalIterator begin;
+            BidirectionalIterator end;
+            difference_type offset;
+            difference_type size;
+            // Power of the boundary with the previous run
+            int power;
+        };
+
+        // Node powers are strictly increasing from the bottom of the
+        // stack to its top, so its height is bounded by the number of
+        // bits needed to represent twice the size of the collection
+        constexpr int max_stack_size = std::numeric_limits<difference_type>::digits + 3;
+        stack_entry stack[max_stack_size];
+        int stack_size = 0;
+
+        // Single memory buffer used by all the merge operations
+        temporary_buffer<rvalue_type_t<BidirectionalIterator>> buffer(nullptr);
+
+        auto merge_top_runs = [&] {
+            auto& left = stack[stack_size - 2];
+            auto& right = stack[stack_size - 1];
+            verge::merge_adjacent_runs(left.begin, left.end, right.end,
+                                       left.size, right.size, buffer,
+                                       compare, projection);
+            left.end = right.end;
+            left.size += right.size;
+            --stack_size;
+        };
+
+        stack[0] = { first, runs.front().end, 0, runs.front().size, 0 };
+        stack_size = 1;
+
+        for (auto it = std::next(runs.begin()) ; it != runs.end() ; ++it) {
+            auto& top = stack[stack_size - 1];
+            int power = verge::node_power(size, top.offset, top.size, it->size);
+            // Merge the runs whose boundaries have a bigger power
+            // than the boundary between the top run and the new one
+            while (stack_size > 1 && stack[stack_size - 1].power > power) {
+                merge_top_runs();
             }
-        } while (runs.size() > 1);
+
+            CPPSORT_ASSERT(stack_size < max_stack_size);
+            auto& new_top = stack[stack_size - 1];
+            auto& entry = stack[stack_size];
+            entry.begin = new_top.end;
+            entry.end = it->end;
+            entry.offset = new_top.offset + new_top.size;
+            entry.size = it->size;
+            entry.power = power;
+            ++stack_size;
+        }
+
+        // Merge the remaining runs from right to left
+        while (stack_size > 1) {
+            merge_top_runs();
+        }
     }
 
     ////////////////////////////////////////////////////////////
@@ -125,8 +231,8 @@ namespace verge
 
         // Vergesort detects big runs in ascending or descending order,
         // and remembers where each run ends by storing the end iterator
-        // of each run in this list, then it performs a k-way merge
-        std::list<verge::run<BidirectionalIterator>> runs;
+        // of each run in this array, then it merges all of them
+        std::vector<verge::run<BidirectionalIterator>> runs;
 
         // Beginning of an "unsorted" partition, last if the previous
         // partition is sorted: as long as the algorithm does not find a
@@ -319,7 +425,7 @@ namespace verge
         }
 
         // Last step: merge the runs
-        verge::merge_runs(first, runs, std::move(compare), std::move(projection));
+        verge::merge_runs(first, size, runs, std::move(compare), std::move(projection));
     }
 
     template<
@@ -345,7 +451,7 @@ namespace verge
         // See the bidirectional overload for the description of
         // the following variables
         const difference_type_t<RandomAccessIterator> minrun_limit = size / log2(size);
-        std::list<verge::run<RandomAccessIterator>> runs;
+        std::vector<verge::run<RandomAccessIterator>> runs;
         auto begin_unsorted = last;
 
         // Pair of iterators to iterate through the collection
@@ -497,7 +603,7 @@ namespace verge
         }
 
         // Last step: merge the runs
-        verge::merge_runs(first, runs, std::move(compare), std::move(projection));
+        verge::merge_runs(first, size, runs, std::move(compare), std::move(projection));
     }
 
     ////////////////////////////////////////////////////////////
@@ -19,6 +19,7 @@
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/iter_move.h>
 #include "../detail/empty_sorter.h"
+#include "../detail/low_moves/cycle_sort.h"
 #include "../detail/minmax_element.h"
 
 namespace cppsort
@@ -45,11 +46,33 @@ namespace cppsort
             auto operator()(RandomAccessIterator first, RandomAccessIterator last,
                             Compare compare={}, Projection projection={}) const
                 -> void
+            {
+                using use_cycle_sort = std::integral_constant<bool,
+                    (N <= low_moves_cycle_sort_max_size)
+                >;
+                sort(use_cycle_sort{}, std::move(first), std::move(last),
+                     std::move(compare), std::move(projection));
+            }
+
+        private:
+
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            static auto sort(std::true_type, RandomAccessIterator first, RandomAccessIterator,
+                             Compare compare, Projection projection)
+                -> void
+            {
+                low_moves_cycle_sort<N>(std::move(first), std::move(compare), std::move(projection));
+            }
+
+            template<typename RandomAccessIterator, typename Compare, typename Projection>
+            static auto sort(std::false_type, RandomAccessIterator first, RandomAccessIterator last,
+                             Compare compare, Projection projection)
+                -> void
             {
                 using utility::iter_swap;
 
-                // There are specializations for N < 5, so unchecked_minmax_element
-                // will always be passed at least 2 elements
+                // Bidirectional selection sort until the collection
+                // is small enough for low_moves_cycle_sort
                 RandomAccessIterator min, max;
                 std::tie(min, max) = unchecked_minmax_element(first, last, compare, projection);
                 --last;
@@ -121,6 +144,5 @@ namespace cppsort
 // Specializations of low_moves_sorter for some values of N
 #include "../detail/low_moves/sort2.h"
 #include "../detail/low_moves/sort3.h"
-#include "../detail/low_moves/sort4.h"
 
 #endif // CPPSORT_FIXED_LOW_MOVES_SORTER_H_
@@ -24,13 +24,12 @@ namespace cppsort
     namespace detail
     {
         template<std::size_t N>
-        struct sorting_network_sorter_impl
-        {
-            static_assert(
-                N && false,
-                "sorting_network_sorter has no specialization for this size of N"
-            );
-        };
+        struct merged_sorting_network_sorter_impl;
+
+        template<std::size_t N>
+        struct sorting_network_sorter_impl:
+            merged_sorting_network_sorter_impl<N>
+        {};
 
         template<>
         struct sorting_network_sorter_impl<0u>:
@@ -66,7 +65,7 @@ namespace cppsort
     template<>
     struct fixed_sorter_traits<sorting_network_sorter>
     {
-        using domain = std::make_index_sequence<33>;
+        using domain = std::make_index_sequence<65>;
         using iterator_category = std::random_access_iterator_tag;
         using is_always_stable = std::false_type;
     };
@@ -77,6 +76,8 @@ namespace cppsort
 #include <functional>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/sorting_networks.h>
+#include "../detail/config.h"
+#include "../detail/iterator_traits.h"
 #include "../detail/swap_if.h"
 #include "../detail/type_traits.h"
 
@@ -112,5 +113,6 @@ namespace cppsort
 #include "../detail/sorting_network/sort30.h"
 #include "../detail/sorting_network/sort31.h"
 #include "../detail/sorting_network/sort32.h"
+#include "../detail/sorting_network/merged_networks.h"
 
 #endif // CPPSORT_FIXED_SORTING_NETWORK_SORTER_H_
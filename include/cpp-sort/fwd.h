@@ -24,6 +24,7 @@ namespace cppsort
     ////////////////////////////////////////////////////////////
     // Sorters
 
+    struct auto_sorter;
     template<typename BufferProvider>
     struct block_sorter;
     struct cartesian_tree_sorter;
@@ -78,6 +79,8 @@ namespace cppsort
     struct container_aware_adapter;
     template<typename Sorter, typename CountType=std::size_t>
     struct counting_adapter;
+    template<typename Sorter>
+    struct external_adapter;
     template<typename... Sorters>
     struct hybrid_adapter;
     template<typename Sorter>
@@ -90,6 +93,10 @@ namespace cppsort
     struct self_sort_adapter;
     template<template<std::size_t> class FixedSizeSorter, typename Indices>
     struct small_array_adapter;
+    template<template<std::size_t> class FixedSizeSorter, typename Sorter, typename Indices>
+    struct small_collection_adapter;
+    template<typename Sorter>
+    struct sorted_prefix_adapter;
     template<typename Sorter>
     struct stable_adapter;
     template<typename Sorter>
@@ -8,7 +8,9 @@
 ////////////////////////////////////////////////////////////
 // Headers
 ////////////////////////////////////////////////////////////
+#include <cpp-sort/probes/approximate.h>
 #include <cpp-sort/probes/block.h>
+#include <cpp-sort/probes/combined.h>
 #include <cpp-sort/probes/dis.h>
 #include <cpp-sort/probes/enc.h>
 #include <cpp-sort/probes/exc.h>
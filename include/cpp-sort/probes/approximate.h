@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_PROBES_APPROXIMATE_H_
+#define CPPSORT_PROBES_APPROXIMATE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+#include "inv.h"
+#include "runs.h"
+
+namespace cppsort
+{
+namespace probe
+{
+    ////////////////////////////////////////////////////////////
+    // Result of an approximate measure of presortedness: the
+    // estimated value and the bounds of its 95% confidence
+    // interval, all three being equal when the measure could
+    // be computed exactly
+
+    template<typename Integer>
+    struct estimate
+    {
+        Integer value;
+        Integer lower_bound;
+        Integer upper_bound;
+    };
+
+    namespace detail
+    {
+        ////////////////////////////////////////////////////////////
+        // Sampling helpers
+        //
+        // The pseudo-random number generator is always seeded with
+        // the same value to keep the probes deterministic
+
+        using sample_engine = std::minstd_rand;
+
+        template<typename Integer>
+        auto random_index(sample_engine& engine, Integer bound)
+            -> Integer
+        {
+            // minstd_rand only produces 31 bits per call
+            std::uint_fast64_t value = engine();
+            value = (value << 31u) ^ engine();
+            return static_cast<Integer>(value % static_cast<std::uint_fast64_t>(bound));
+        }
+
+        template<typename Integer>
+        auto exact_estimate(Integer value)
+            -> estimate<Integer>
+        {
+            return { value, value, value };
+        }
+
+        // Scale the proportion of positive outcomes in the sample
+        // to the measure, the confidence interval being computed
+        // with the Wilson score interval, which remains meaningful
+        // when the proportion is close to 0 or 1
+        template<typename Integer>
+        auto estimate_from_sample(int nb_positives, int sample_size, Integer max_value)
+            -> estimate<Integer>
+        {
+            constexpr double z = 1.96;
+            double n = sample_size;
+            double p = nb_positives / n;
+
+            double denominator = 1.0 + z * z / n;
+            double center = (p + z * z / (2.0 * n)) / denominator;
+            double half_width = z / denominator * std::sqrt(p * (1.0 - p) / n + z * z / (4.0 * n * n));
+
+            double max = static_cast<double>(max_value);
+            auto clamp = [max](double value) {
+                return static_cast<Integer>(value < 0.0 ? 0.0 : value > max ? max : value);
+            };
+            return {
+                clamp(std::round(p * max)),
+                clamp(std::floor((center - half_width) * max)),
+                clamp(std::ceil((center + half_width) * max))
+            };
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Approximate Runs: proportion of descents among randomly
+        // chosen pairs of adjacent elements
+
+        template<int SampleSize>
+        struct approximate_runs_impl
+        {
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> estimate<cppsort::detail::difference_type_t<RandomAccessIterator>>
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        cppsort::detail::iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "probe::approximate::runs requires at least random-access iterators"
+                );
+
+                using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                auto size = last - first;
+                if (size - 1 <= SampleSize) {
+                    return exact_estimate<difference_type>(
+                        runs_impl{}(first, last, std::move(compare), std::move(projection))
+                    );
+                }
+
+                sample_engine engine;
+                int nb_descents = 0;
+                for (int i = 0 ; i < SampleSize ; ++i) {
+                    auto it = first + random_index(engine, size - 1);
+                    if (comp(proj(it[1]), proj(*it))) {
+                        ++nb_descents;
+                    }
+                }
+                return estimate_from_sample(nb_descents, SampleSize, runs_impl::max_for_size(size));
+            }
+
+            template<typename Integer>
+            static constexpr auto max_for_size(Integer n)
+                -> Integer
+            {
+                return runs_impl::max_for_size(n);
+            }
+        };
+
+        ////////////////////////////////////////////////////////////
+        // Approximate Inv: proportion of inversions among randomly
+        // chosen pairs of elements
+
+        template<int SampleSize>
+        struct approximate_inv_impl
+        {
+            template<
+                typename RandomAccessIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+                >
+            >
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> estimate<cppsort::detail::difference_type_t<RandomAccessIterator>>
+            {
+                static_assert(
+                    std::is_base_of<
+                        std::random_access_iterator_tag,
+                        cppsort::detail::iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "probe::approximate::inv requires at least random-access iterators"
+                );
+
+                using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+
+                auto size = last - first;
+                auto max_value = inv_impl::max_for_size(size);
+                if (max_value <= SampleSize) {
+                    return exact_estimate<difference_type>(
+                        inv_probe_algo(first, last, size, std::move(compare), std::move(projection))
+                    );
+                }
+
+                sample_engine engine;
+                int nb_inversions = 0;
+                for (int i = 0 ; i < SampleSize ; ++i) {
+                    // Pick two distinct positions with a uniform distribution
+                    auto pos1 = random_index(engine, size);
+                    auto pos2 = random_index(engine, size - 1);
+                    if (pos2 >= pos1) {
+                        ++pos2;
+                    } else {
+                        std::swap(pos1, pos2);
+                    }
+                    if (comp(proj(first[pos2]), proj(first[pos1]))) {
+                        ++nb_inversions;
+                    }
+                }
+                return estimate_from_sample(nb_inversions, SampleSize, max_value);
+            }
+
+            template<typename Integer>
+            static constexpr auto max_for_size(Integer n)
+                -> Integer
+            {
+                return inv_impl::max_for_size(n);
+            }
+        };
+    }
+
+    namespace approximate
+    {
+        template<int SampleSize>
+        struct inv_probe:
+            sorter_facade<detail::approximate_inv_impl<SampleSize>>
+        {};
+
+        template<int SampleSize>
+        struct runs_probe:
+            sorter_facade<detail::approximate_runs_impl<SampleSize>>
+        {};
+
+        namespace
+        {
+            constexpr auto&& inv = utility::static_const<inv_probe<512>>::value;
+            constexpr auto&& runs = utility::static_const<runs_probe<512>>::value;
+        }
+    }
+}}
+
+#endif // CPPSORT_PROBES_APPROXIMATE_H_
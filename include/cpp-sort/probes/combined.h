@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_PROBES_COMBINED_H_
+#define CPPSORT_PROBES_COMBINED_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/as_function.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/count_inversions.h"
+#include "../detail/functional.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/longest_non_descending_subsequence.h"
+#include "../detail/pdqsort.h"
+#include "../detail/type_traits.h"
+#include "dis.h"
+#include "max.h"
+
+namespace cppsort
+{
+namespace probe
+{
+    ////////////////////////////////////////////////////////////
+    // Measures that can be computed by the combined probe
+
+    namespace measure
+    {
+        constexpr unsigned dis = 1u << 0;
+        constexpr unsigned inv = 1u << 1;
+        constexpr unsigned max = 1u << 2;
+        constexpr unsigned rem = 1u << 3;
+        constexpr unsigned runs = 1u << 4;
+
+        constexpr unsigned all = dis | inv | max | rem | runs;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Result of the combined probe, the measures that were not
+    // requested are set to -1
+
+    template<typename Integer>
+    struct combined_result
+    {
+        Integer dis = -1;
+        Integer inv = -1;
+        Integer max = -1;
+        Integer rem = -1;
+        Integer runs = -1;
+    };
+
+    namespace detail
+    {
+        template<unsigned Measures, typename ForwardIterator, typename Compare, typename Projection>
+        auto combined_probe_algo(ForwardIterator first, ForwardIterator last,
+                                 cppsort::detail::difference_type_t<ForwardIterator> size,
+                                 Compare compare, Projection projection)
+            -> combined_result<cppsort::detail::difference_type_t<ForwardIterator>>
+        {
+            using difference_type = cppsort::detail::difference_type_t<ForwardIterator>;
+            using category = cppsort::detail::iterator_category_t<ForwardIterator>;
+            auto&& comp = utility::as_function(compare);
+            auto&& proj = utility::as_function(projection);
+
+            constexpr bool needs_iterators = Measures & (measure::inv | measure::max);
+
+            combined_result<difference_type> res;
+            if (Measures & measure::dis) res.dis = 0;
+            if (Measures & measure::inv) res.inv = 0;
+            if (Measures & measure::max) res.max = 0;
+            if (Measures & measure::rem) res.rem = 0;
+            if (Measures & measure::runs) res.runs = 0;
+            if (size < 2) {
+                return res;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Single pass over the collection: store the iterators and
+            // count the descents at the same time
+
+            std::unique_ptr<ForwardIterator[]> iterators;
+            if (needs_iterators) {
+                iterators = std::make_unique<ForwardIterator[]>(size);
+            }
+
+            if (needs_iterators || (Measures & measure::runs)) {
+                auto store = iterators.get();
+                auto prev = first;
+                for (auto it = first ; it != last ; ++it) {
+                    if (needs_iterators) {
+                        *store++ = it;
+                    }
+                    if ((Measures & measure::runs) && it != first) {
+                        if (comp(proj(*it), proj(*prev))) {
+                            ++res.runs;
+                        }
+                        prev = it;
+                    }
+                }
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Sort the iterators on pointed values: counting inversions
+            // with a merge sort sorts the iterators as a side effect,
+            // which is reused to compute Max
+
+            if (Measures & measure::inv) {
+                auto buffer = std::make_unique<ForwardIterator[]>(size);
+                res.inv = cppsort::detail::count_inversions<difference_type>(
+                    iterators.get(), iterators.get() + size, buffer.get(),
+                    compare, cppsort::detail::indirect(projection)
+                );
+            } else if (Measures & measure::max) {
+                cppsort::detail::pdqsort(
+                    iterators.get(), iterators.get() + size,
+                    compare, cppsort::detail::indirect(projection)
+                );
+            }
+
+            if (Measures & measure::max) {
+                res.max = max_distance_to_sorted_position(
+                    first, last, iterators.get(), iterators.get() + size,
+                    compare, projection
+                );
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Measures that don't benefit from the sorted iterators
+
+            if (Measures & measure::rem) {
+                auto lnds = cppsort::detail::longest_non_descending_subsequence<false>(
+                    first, last, size, compare, projection
+                );
+                auto rem = lnds.second - lnds.first;
+                res.rem = rem >= 0 ? rem : 0;
+            }
+
+            if (Measures & measure::dis) {
+                res.dis = dis_probe_algo(first, last, size, compare, projection, category{});
+            }
+
+            return res;
+        }
+
+        template<unsigned Measures>
+        struct combined_impl
+        {
+            static_assert(Measures != 0 && (Measures & ~measure::all) == 0,
+                          "combined_probe must be given a non-empty combination of measures");
+
+            template<
+                typename ForwardIterable,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_v<Projection, ForwardIterable, Compare>
+                >
+            >
+            auto operator()(ForwardIterable&& iterable,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                return combined_probe_algo<Measures>(std::begin(iterable), std::end(iterable),
+                                                     utility::size(iterable),
+                                                     std::move(compare), std::move(projection));
+            }
+
+            template<
+                typename ForwardIterator,
+                typename Compare = std::less<>,
+                typename Projection = utility::identity,
+                typename = cppsort::detail::enable_if_t<
+                    is_projection_iterator_v<Projection, ForwardIterator, Compare>
+                >
+            >
+            auto operator()(ForwardIterator first, ForwardIterator last,
+                            Compare compare={}, Projection projection={}) const
+                -> decltype(auto)
+            {
+                return combined_probe_algo<Measures>(first, last, std::distance(first, last),
+                                                     std::move(compare), std::move(projection));
+            }
+        };
+    }
+
+    template<unsigned Measures>
+    struct combined_probe:
+        sorter_facade<detail::combined_impl<Measures>>
+    {};
+
+    namespace
+    {
+        constexpr auto&& combined = utility::static_const<
+            combined_probe<measure::all>
+        >::value;
+    }
+}}
+
+#endif // CPPSORT_PROBES_COMBINED_H_
@@ -32,15 +32,53 @@ namespace probe
 {
     namespace detail
     {
+        template<
+            typename ForwardIterator,
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection
+        >
+        auto max_distance_to_sorted_position(ForwardIterator first, ForwardIterator last,
+                                             RandomAccessIterator sorted_first,
+                                             RandomAccessIterator sorted_last,
+                                             Compare compare, Projection projection)
+            -> ::cppsort::detail::difference_type_t<ForwardIterator>
+        {
+            using difference_type = ::cppsort::detail::difference_type_t<ForwardIterator>;
+            auto&& proj = utility::as_function(projection);
+
+            // [sorted_first, sorted_last) contains iterators to the
+            // elements of [first, last) sorted on pointed values
+
+            difference_type max_dist = 0;
+            difference_type it_pos = 0;
+            for (auto it = first ; it != last ; ++it) {
+                // Find the range where *first belongs once sorted
+                auto rng = cppsort::detail::equal_range(
+                    sorted_first, sorted_last, proj(*it),
+                    compare, cppsort::detail::indirect(projection)
+                );
+                auto pos_min = std::distance(sorted_first, rng.first);
+                auto pos_max = std::distance(sorted_first, rng.second);
+
+                // If *first isn't into one of its sorted positions, computed the closest
+                if (it_pos < pos_min) {
+                    max_dist = (std::max)(pos_min - it_pos, max_dist);
+                } else if (it_pos >= pos_max) {
+                    max_dist = (std::max)(it_pos - pos_max + 1, max_dist);
+                }
+
+                ++it_pos;
+            }
+            return max_dist;
+        }
+
         template<typename ForwardIterator, typename Compare, typename Projection>
         auto max_probe_algo(ForwardIterator first, ForwardIterator last,
                             cppsort::detail::difference_type_t<ForwardIterator> size,
                             Compare compare, Projection projection)
             -> ::cppsort::detail::difference_type_t<ForwardIterator>
         {
-            using difference_type = ::cppsort::detail::difference_type_t<ForwardIterator>;
-            auto&& proj = utility::as_function(projection);
-
             if (size < 2) {
                 return 0;
             }
@@ -64,27 +102,10 @@ namespace probe
             // Maximum distance an element has to travel in order to
             // reach its sorted position
 
-            difference_type max_dist = 0;
-            difference_type it_pos = 0;
-            for (auto it = first ; it != last ; ++it) {
-                // Find the range where *first belongs once sorted
-                auto rng = cppsort::detail::equal_range(
-                    iterators.begin(), iterators.end(), proj(*it),
-                    compare, cppsort::detail::indirect(projection)
-                );
-                auto pos_min = std::distance(iterators.begin(), rng.first);
-                auto pos_max = std::distance(iterators.begin(), rng.second);
-
-                // If *first isn't into one of its sorted positions, computed the closest
-                if (it_pos < pos_min) {
-                    max_dist = (std::max)(pos_min - it_pos, max_dist);
-                } else if (it_pos >= pos_max) {
-                    max_dist = (std::max)(it_pos - pos_max + 1, max_dist);
-                }
-
-                ++it_pos;
-            }
-            return max_dist;
+            return max_distance_to_sorted_position(
+                first, last, iterators.begin(), iterators.end(),
+                std::move(compare), std::move(projection)
+            );
         }
 
         struct max_impl
@@ -16,6 +16,7 @@
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/static_const.h>
+#include "../detail/config.h"
 #include "../detail/insertion_sort.h"
 #include "../detail/iterator_traits.h"
 #include "../detail/type_traits.h"
@@ -37,6 +38,7 @@ namespace cppsort
                     is_projection_iterator_v<Projection, BidirectionalIterator, Compare>
                 >
             >
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             auto operator()(BidirectionalIterator first, BidirectionalIterator last,
                             Compare compare={}, Projection projection={}) const
                 -> void
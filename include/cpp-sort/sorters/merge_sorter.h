@@ -17,6 +17,7 @@
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/size.h>
 #include <cpp-sort/utility/static_const.h>
+#include "../detail/config.h"
 #include "../detail/iterator_traits.h"
 #include "../detail/merge_sort.h"
 #include "../detail/type_traits.h"
@@ -38,6 +39,7 @@ namespace cppsort
                     is_projection_v<Projection, ForwardIterable, Compare>
                 >
             >
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             auto operator()(ForwardIterable&& iterable,
                             Compare compare={}, Projection projection={}) const
                 -> void
@@ -63,6 +65,7 @@ namespace cppsort
                     is_projection_iterator_v<Projection, ForwardIterator, Compare>
                 >
             >
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             auto operator()(ForwardIterator first, ForwardIterator last,
                             Compare compare={}, Projection projection={}) const
                 -> void
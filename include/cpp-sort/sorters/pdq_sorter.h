@@ -16,6 +16,7 @@
 #include <cpp-sort/sorter_traits.h>
 #include <cpp-sort/utility/functional.h>
 #include <cpp-sort/utility/static_const.h>
+#include "../detail/config.h"
 #include "../detail/iterator_traits.h"
 #include "../detail/pdqsort.h"
 #include "../detail/type_traits.h"
@@ -37,6 +38,7 @@ namespace cppsort
                     is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
                 >
             >
+            CPPSORT_CONSTEXPR_AFTER_CXX17
             auto operator()(RandomAccessIterator first, RandomAccessIterator last,
                             Compare compare={}, Projection projection={}) const
                 -> void
@@ -75,4 +77,10 @@ namespace cppsort
     }
 }
 
+#ifdef CPPSORT_ADAPTERS_CONTAINER_AWARE_ADAPTER_DONE_
+#include "../detail/container_aware/pdq_sort.h"
+#endif
+
+#define CPPSORT_SORTERS_PDQ_SORTER_DONE_
+
 #endif // CPPSORT_SORTERS_PDQ_SORTER_H_
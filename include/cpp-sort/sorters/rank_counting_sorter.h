@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_SORTERS_RANK_COUNTING_SORTER_H_
+#define CPPSORT_SORTERS_RANK_COUNTING_SORTER_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/utility/static_const.h>
+#include "../detail/rank_counting_sort.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter
+
+    namespace detail
+    {
+        struct rank_counting_sorter_impl
+        {
+            template<typename RandomAccessIterator>
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last) const
+                -> detail::enable_if_t<
+                    detail::is_integral<value_type_t<RandomAccessIterator>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "rank_counting_sorter requires random-access iterators"
+                );
+
+                rank_counting_sort(std::move(first), std::move(last), std::less<>{});
+            }
+
+            template<typename RandomAccessIterator>
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last, std::greater<>) const
+                -> detail::enable_if_t<
+                    detail::is_integral<value_type_t<RandomAccessIterator>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "rank_counting_sorter requires random-access iterators"
+                );
+
+                rank_counting_sort(std::move(first), std::move(last), std::greater<>{});
+            }
+
+#ifdef __cpp_lib_ranges
+            template<typename RandomAccessIterator>
+            auto operator()(RandomAccessIterator first, RandomAccessIterator last, std::ranges::greater) const
+                -> detail::enable_if_t<
+                    detail::is_integral<value_type_t<RandomAccessIterator>>::value
+                >
+            {
+                static_assert(
+                    std::is_base_of<
+                        iterator_category,
+                        iterator_category_t<RandomAccessIterator>
+                    >::value,
+                    "rank_counting_sorter requires random-access iterators"
+                );
+
+                rank_counting_sort(std::move(first), std::move(last), std::greater<>{});
+            }
+#endif
+
+            ////////////////////////////////////////////////////////////
+            // Sorter traits
+
+            using iterator_category = std::random_access_iterator_tag;
+            using is_always_stable = std::false_type;
+        };
+    }
+
+    struct rank_counting_sorter:
+        sorter_facade<detail::rank_counting_sorter_impl>
+    {};
+
+    ////////////////////////////////////////////////////////////
+    // Sort function
+
+    namespace
+    {
+        constexpr auto&& rank_counting_sort
+            = utility::static_const<rank_counting_sorter>::value;
+    }
+}
+
+#endif // CPPSORT_SORTERS_RANK_COUNTING_SORTER_H_
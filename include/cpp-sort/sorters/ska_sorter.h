@@ -75,4 +75,10 @@ namespace cppsort
     }
 }
 
+#ifdef CPPSORT_ADAPTERS_CONTAINER_AWARE_ADAPTER_DONE_
+#include "../detail/container_aware/ska_sort.h"
+#endif
+
+#define CPPSORT_SORTERS_SKA_SORTER_DONE_
+
 #endif // CPPSORT_SORTERS_SKA_SORTER_H_
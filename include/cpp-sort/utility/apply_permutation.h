@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_APPLY_PERMUTATION_H_
+#define CPPSORT_UTILITY_APPLY_PERMUTATION_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include "../detail/apply_permutation.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/memory.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        // Gathering the elements into a buffer moves every element
+        // twice but writes them sequentially and prefetches the reads,
+        // which beats following the cycles as long as the elements
+        // are not bigger than a cache line; above that size, moving
+        // the elements a second time costs more than the cache
+        // misses it saves
+        constexpr std::size_t permutation_max_buffered_size = 64;
+
+        // Under that number of elements, allocating the buffer is
+        // more expensive than following the cycles
+        constexpr std::ptrdiff_t permutation_min_buffered_elements = 32;
+
+        template<typename RandomAccessIterator>
+        auto use_buffered_permutation(cppsort::detail::difference_type_t<RandomAccessIterator> size)
+            -> bool
+        {
+            using rvalue_type = cppsort::detail::rvalue_type_t<RandomAccessIterator>;
+            return sizeof(rvalue_type) <= permutation_max_buffered_size
+                && size >= permutation_min_buffered_elements;
+        }
+
+        template<typename RandomAccessIterator, typename IndexIterator>
+        auto apply_inverse_permutation(std::true_type,
+                                       RandomAccessIterator first, RandomAccessIterator last,
+                                       IndexIterator indices)
+            -> void
+        {
+            using rvalue_type = cppsort::detail::rvalue_type_t<RandomAccessIterator>;
+
+            auto size = last - first;
+            if (use_buffered_permutation<RandomAccessIterator>(size)) {
+                cppsort::detail::temporary_buffer<rvalue_type> buffer(size);
+                if (buffer.size() >= size) {
+                    cppsort::detail::apply_inverse_permutation_buffered(first, last, indices,
+                                                                        buffer.data());
+                    return;
+                }
+            }
+            cppsort::detail::apply_inverse_permutation(first, last, indices);
+        }
+
+        template<typename RandomAccessIterator, typename IndexIterator>
+        auto apply_inverse_permutation(std::false_type,
+                                       RandomAccessIterator first, RandomAccessIterator last,
+                                       IndexIterator indices)
+            -> void
+        {
+            // Scattering elements into a buffer is only safe when
+            // moving them can't throw
+            cppsort::detail::apply_inverse_permutation(first, last, indices);
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Move the elements of [first, last) so that the element
+    // originally at position indices[n] ends up at position n
+
+    template<typename RandomAccessIterator, typename RandomAccessIndexIterator>
+    auto apply_permutation(RandomAccessIterator first, RandomAccessIterator last,
+                           RandomAccessIndexIterator indices)
+        -> void
+    {
+        using rvalue_type = cppsort::detail::rvalue_type_t<RandomAccessIterator>;
+
+        auto size = last - first;
+        if (detail::use_buffered_permutation<RandomAccessIterator>(size)) {
+            cppsort::detail::temporary_buffer<rvalue_type> buffer(size);
+            if (buffer.size() >= size) {
+                cppsort::detail::apply_permutation_buffered(first, last, indices, buffer.data());
+                return;
+            }
+        }
+        // Big elements, small collection or not enough memory
+        cppsort::detail::apply_permutation(first, last, indices);
+    }
+
+    template<typename RandomAccessIterable, typename RandomAccessIndexIterable>
+    auto apply_permutation(RandomAccessIterable&& iterable, RandomAccessIndexIterable&& indices)
+        -> void
+    {
+        utility::apply_permutation(std::begin(iterable), std::end(iterable), std::begin(indices));
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Move the elements of [first, last) so that the element
+    // originally at position n ends up at position indices[n]
+
+    template<typename RandomAccessIterator, typename RandomAccessIndexIterator>
+    auto apply_inverse_permutation(RandomAccessIterator first, RandomAccessIterator last,
+                                   RandomAccessIndexIterator indices)
+        -> void
+    {
+        using rvalue_type = cppsort::detail::rvalue_type_t<RandomAccessIterator>;
+        detail::apply_inverse_permutation(std::is_nothrow_move_constructible<rvalue_type>{},
+                                          first, last, indices);
+    }
+
+    template<typename RandomAccessIterable, typename RandomAccessIndexIterable>
+    auto apply_inverse_permutation(RandomAccessIterable&& iterable, RandomAccessIndexIterable&& indices)
+        -> void
+    {
+        utility::apply_inverse_permutation(std::begin(iterable), std::end(iterable), std::begin(indices));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_APPLY_PERMUTATION_H_
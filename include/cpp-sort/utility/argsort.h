@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_ARGSORT_H_
+#define CPPSORT_UTILITY_ARGSORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include <cpp-sort/utility/size.h>
+#include "../detail/config.h"
+#include "../detail/functional.h"
+#include "../detail/index_sort.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/pdqsort.h"
+#include "../detail/ska_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        template<typename Index, typename RandomAccessIterator>
+        auto make_indices(RandomAccessIterator first, RandomAccessIterator last)
+            -> std::vector<Index>
+        {
+            static_assert(
+                std::is_integral<Index>::value && std::is_unsigned<Index>::value,
+                "argsort indices must be unsigned integers"
+            );
+            auto size = last - first;
+            CPPSORT_ASSERT(static_cast<std::uintmax_t>(size) <= std::numeric_limits<Index>::max());
+
+            std::vector<Index> indices;
+            indices.reserve(static_cast<std::size_t>(size));
+            for (Index idx = 0 ; idx != static_cast<Index>(size) ; ++idx) {
+                indices.push_back(idx);
+            }
+            return indices;
+        }
+
+        ////////////////////////////////////////////////////////////
+        // Strategies used by argsort when no sorter is given
+
+        // Small integer keys: sort (key, index) pairs packed into
+        // 64-bit integers with a radix sort, which is stable
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_packed(RandomAccessIterator first, RandomAccessIterator last,
+                            Compare, Projection projection)
+            -> std::vector<Index>
+        {
+            using key_type = cppsort::detail::projected_t<RandomAccessIterator, Projection>;
+            constexpr bool descending = cppsort::detail::is_natural_greater<Compare, key_type>::value;
+            auto&& proj = utility::as_function(projection);
+
+            auto size = last - first;
+            std::vector<std::uint64_t> packed;
+            packed.reserve(static_cast<std::size_t>(size));
+            for (std::uint64_t idx = 0 ; idx != static_cast<std::uint64_t>(size) ; ++idx) {
+                std::uint32_t key = cppsort::detail::to_ordered_bits(proj(*first));
+                if (descending) {
+                    key = ~key;
+                }
+                packed.push_back((std::uint64_t(key) << 32u) | idx);
+                ++first;
+            }
+            cppsort::detail::ska_sort(packed.begin(), packed.end(), utility::identity{});
+
+            std::vector<Index> indices;
+            indices.reserve(static_cast<std::size_t>(size));
+            for (auto value: packed) {
+                indices.push_back(static_cast<Index>(value & 0xffffffffu));
+            }
+            return indices;
+        }
+
+        // Other keys sortable with a radix sort in ascending order
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_radix(RandomAccessIterator first, RandomAccessIterator last,
+                           Compare, Projection projection)
+            -> std::vector<Index>
+        {
+            auto indices = make_indices<Index>(first, last);
+            cppsort::detail::ska_sort(indices.begin(), indices.end(),
+                                      cppsort::detail::indexed(first, std::move(projection)));
+            return indices;
+        }
+
+        // Everything else
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_comparison(RandomAccessIterator first, RandomAccessIterator last,
+                                Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            auto indices = make_indices<Index>(first, last);
+            if (indices.size() > 1) {
+                cppsort::detail::pdqsort(indices.begin(), indices.end(), std::move(compare),
+                                         cppsort::detail::indexed(first, std::move(projection)));
+            }
+            return indices;
+        }
+
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_unpacked(std::true_type, RandomAccessIterator first, RandomAccessIterator last,
+                              Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            return argsort_radix<Index>(first, last, std::move(compare), std::move(projection));
+        }
+
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_unpacked(std::false_type, RandomAccessIterator first, RandomAccessIterator last,
+                              Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            return argsort_comparison<Index>(first, last, std::move(compare), std::move(projection));
+        }
+
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_default(std::true_type, RandomAccessIterator first, RandomAccessIterator last,
+                             Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            auto size = last - first;
+            if (static_cast<std::uintmax_t>(size) <= std::numeric_limits<std::uint32_t>::max()) {
+                return argsort_packed<Index>(first, last, std::move(compare), std::move(projection));
+            }
+            // Indices don't fit in the low half of the packed values
+            return argsort_comparison<Index>(first, last, std::move(compare), std::move(projection));
+        }
+
+        template<typename Index, typename RandomAccessIterator, typename Compare, typename Projection>
+        auto argsort_default(std::false_type, RandomAccessIterator first, RandomAccessIterator last,
+                             Compare compare, Projection projection)
+            -> std::vector<Index>
+        {
+            using key_type = cppsort::detail::projected_t<RandomAccessIterator, Projection>;
+            using is_radix_sortable = std::integral_constant<bool,
+                cppsort::detail::is_ska_sortable_v<key_type> &&
+                cppsort::detail::is_natural_less<Compare, key_type>::value
+            >;
+            return argsort_unpacked<Index>(is_radix_sortable{}, first, last,
+                                           std::move(compare), std::move(projection));
+        }
+
+        template<
+            typename RandomAccessIterator,
+            typename Compare,
+            typename Projection,
+            typename Key = cppsort::detail::projected_t<RandomAccessIterator, Projection>
+        >
+        using can_pack_keys = std::integral_constant<bool,
+            cppsort::detail::is_integral<Key>::value &&
+            sizeof(Key) <= sizeof(std::uint32_t) && (
+                cppsort::detail::is_natural_less<Compare, Key>::value ||
+                cppsort::detail::is_natural_greater<Compare, Key>::value
+            )
+        >;
+
+        template<typename Iterator>
+        using is_random_access = std::is_base_of<
+            std::random_access_iterator_tag,
+            cppsort::detail::iterator_category_t<Iterator>
+        >;
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Indices of the elements of a collection in sorted order:
+    // the element at position indices[n] of the collection is
+    // the one that would be at position n if it was sorted
+
+    template<
+        typename Index = std::size_t,
+        typename Sorter,
+        typename RandomAccessIterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto argsort(Sorter&& sorter, RandomAccessIterable&& iterable,
+                 Compare compare={}, Projection projection={})
+        -> std::vector<Index>
+    {
+        using iterator = decltype(std::begin(iterable));
+        static_assert(detail::is_random_access<iterator>::value,
+                      "argsort requires a random-access collection");
+
+        auto first = std::begin(iterable);
+        auto indices = detail::make_indices<Index>(first, std::end(iterable));
+        std::forward<Sorter>(sorter)(indices.begin(), indices.end(), std::move(compare),
+                                     cppsort::detail::indexed(first, std::move(projection)));
+        return indices;
+    }
+
+    template<
+        typename Index = std::size_t,
+        typename RandomAccessIterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto argsort(RandomAccessIterable&& iterable,
+                 Compare compare={}, Projection projection={})
+        -> std::vector<Index>
+    {
+        using iterator = decltype(std::begin(iterable));
+        static_assert(detail::is_random_access<iterator>::value,
+                      "argsort requires a random-access collection");
+
+        using can_pack = detail::can_pack_keys<iterator, Compare, Projection>;
+        return detail::argsort_default<Index>(can_pack{}, std::begin(iterable), std::end(iterable),
+                                              std::move(compare), std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_ARGSORT_H_
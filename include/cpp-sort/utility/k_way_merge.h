@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_K_WAY_MERGE_H_
+#define CPPSORT_UTILITY_K_WAY_MERGE_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/loser_tree.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        // Source of the loser tree over a sorted range
+        template<typename Iterator, typename Sentinel>
+        struct merge_source
+        {
+            Iterator current;
+            Sentinel end;
+
+            auto empty() const
+                -> bool
+            {
+                return current == end;
+            }
+
+            auto front() const
+                -> decltype(*current)
+            {
+                return *current;
+            }
+
+            auto pop()
+                -> void
+            {
+                ++current;
+            }
+        };
+
+        template<typename Range>
+        using merge_source_t = merge_source<
+            decltype(std::begin(std::declval<Range&>())),
+            decltype(std::end(std::declval<Range&>()))
+        >;
+
+        // Total number of elements of the sources [first, last)
+        template<typename Source>
+        auto merged_size(Source* first, Source* last)
+            -> std::size_t
+        {
+            std::size_t size = 0;
+            for (; first != last ; ++first) {
+                size += static_cast<std::size_t>(std::distance(first->current, first->end));
+            }
+            return size;
+        }
+
+        // Under this number of sources, balanced pairwise merges
+        // with std::merge are faster than the loser tree
+        constexpr std::size_t k_way_merge_pairwise_limit = 8;
+
+        template<typename Source, typename OutputIterator, typename Compare, typename Projection>
+        auto pairwise_merge(Source* first, Source* last, OutputIterator out,
+                            Compare& compare, Projection& projection)
+            -> OutputIterator;
+
+        // Call function with the elements of the sources [first, last)
+        // as a single sorted range: a lone source is passed as is while
+        // several sources are first merged into a temporary buffer
+        template<typename Source, typename Compare, typename Projection, typename Function>
+        auto with_merged(Source* first, Source* last,
+                         Compare& compare, Projection& projection, Function function)
+            -> decltype(auto)
+        {
+            if (last - first == 1) {
+                return function(first->current, first->end);
+            }
+
+            using value_type = cppsort::detail::remove_cvref_t<decltype(first->front())>;
+            std::vector<value_type> buffer;
+            buffer.reserve(merged_size(first, last));
+            pairwise_merge(first, last, std::back_inserter(buffer), compare, projection);
+            return function(std::make_move_iterator(buffer.begin()),
+                            std::make_move_iterator(buffer.end()));
+        }
+
+        // Merge the sources [first, last) with balanced pairwise
+        // merges, the left half of the sources always comes first in
+        // the merges so that the result stays stable
+        template<typename Source, typename OutputIterator, typename Compare, typename Projection>
+        auto pairwise_merge(Source* first, Source* last, OutputIterator out,
+                            Compare& compare, Projection& projection)
+            -> OutputIterator
+        {
+            if (last - first == 1) {
+                return std::copy(first->current, first->end, out);
+            }
+
+            auto less = [&](auto&& lhs, auto&& rhs) -> bool {
+                auto&& comp = utility::as_function(compare);
+                auto&& proj = utility::as_function(projection);
+                return comp(proj(lhs), proj(rhs));
+            };
+            auto middle = first + (last - first + 1) / 2;
+            return with_merged(first, middle, compare, projection, [&](auto lhs_first, auto lhs_last) {
+                return with_merged(middle, last, compare, projection, [&](auto rhs_first, auto rhs_last) {
+                    return std::merge(lhs_first, lhs_last, rhs_first, rhs_last, out, less);
+                });
+            });
+        }
+    }
+
+    template<
+        typename Ranges,
+        typename OutputIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_v<Projection, decltype(*std::begin(std::declval<Ranges&>())), Compare>
+        >
+    >
+    auto k_way_merge(Ranges&& ranges, OutputIterator out,
+                     Compare compare={}, Projection projection={})
+        -> OutputIterator
+    {
+        using source_type = detail::merge_source_t<decltype(*std::begin(ranges))>;
+
+        std::vector<source_type> sources;
+        for (auto&& range: ranges) {
+            source_type source = { std::begin(range), std::end(range) };
+            if (not source.empty()) {
+                sources.push_back(std::move(source));
+            }
+        }
+
+        if (sources.empty()) {
+            return out;
+        }
+        if (sources.size() < detail::k_way_merge_pairwise_limit) {
+            return detail::pairwise_merge(sources.data(), sources.data() + sources.size(),
+                                          out, compare, projection);
+        }
+
+        // Ties are broken in favour of the source with the smallest
+        // index, which makes the merge stable
+        cppsort::detail::loser_tree<source_type, Compare, Projection> tree(
+            sources.data(), sources.size(),
+            std::move(compare), std::move(projection)
+        );
+        do {
+            auto& source = tree.top();
+            *out = *source.current;
+            ++out;
+            tree.pop();
+        } while (not tree.empty());
+        return out;
+    }
+}}
+
+#endif // CPPSORT_UTILITY_K_WAY_MERGE_H_
@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_LAZY_SORTED_VIEW_H_
+#define CPPSORT_UTILITY_LAZY_SORTED_VIEW_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/incremental_quicksort.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity
+    >
+    class lazy_sorted_view
+    {
+        static_assert(
+            std::is_base_of<
+                std::random_access_iterator_tag,
+                cppsort::detail::iterator_category_t<RandomAccessIterator>
+            >::value,
+            "lazy_sorted_view requires at least random-access iterators"
+        );
+
+        public:
+
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+            using size_type = std::make_unsigned_t<difference_type>;
+            using value_type = cppsort::detail::value_type_t<RandomAccessIterator>;
+            using reference = cppsort::detail::reference_t<RandomAccessIterator>;
+
+        private:
+
+            // The state lives on the heap so that iterators remain
+            // valid when the view is moved
+            struct state_type
+            {
+                RandomAccessIterator first;
+                difference_type size;
+                cppsort::detail::incremental_quicksort<
+                    RandomAccessIterator, Compare, Projection
+                > sorter;
+
+                auto at(difference_type pos)
+                    -> reference
+                {
+                    sorter.sort_until(pos);
+                    return first[pos];
+                }
+            };
+
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Iterator: dereferencing it sorts the collection up to
+            // the element it points to
+
+            class iterator
+            {
+                public:
+
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = typename lazy_sorted_view::value_type;
+                    using difference_type = typename lazy_sorted_view::difference_type;
+                    using pointer = RandomAccessIterator;
+                    using reference = typename lazy_sorted_view::reference;
+
+                    iterator() = default;
+
+                    iterator(state_type* state, difference_type pos):
+                        state_(state),
+                        pos_(pos)
+                    {}
+
+                    auto operator*() const
+                        -> reference
+                    {
+                        return state_->at(pos_);
+                    }
+
+                    auto operator->() const
+                        -> pointer
+                    {
+                        state_->sorter.sort_until(pos_);
+                        return state_->first + pos_;
+                    }
+
+                    auto operator++()
+                        -> iterator&
+                    {
+                        ++pos_;
+                        return *this;
+                    }
+
+                    auto operator++(int)
+                        -> iterator
+                    {
+                        auto tmp = *this;
+                        operator++();
+                        return tmp;
+                    }
+
+                    friend auto operator==(const iterator& lhs, const iterator& rhs)
+                        -> bool
+                    {
+                        return lhs.pos_ == rhs.pos_;
+                    }
+
+                    friend auto operator!=(const iterator& lhs, const iterator& rhs)
+                        -> bool
+                    {
+                        return lhs.pos_ != rhs.pos_;
+                    }
+
+                private:
+
+                    state_type* state_ = nullptr;
+                    difference_type pos_ = 0;
+            };
+
+            ////////////////////////////////////////////////////////////
+            // Construction
+
+            lazy_sorted_view(RandomAccessIterator first, RandomAccessIterator last,
+                             Compare compare={}, Projection projection={}):
+                state_(new state_type{
+                    first, last - first,
+                    { first, last, std::move(compare), std::move(projection) }
+                })
+            {}
+
+            ////////////////////////////////////////////////////////////
+            // Access
+
+            auto begin()
+                -> iterator
+            {
+                return { state_.get(), 0 };
+            }
+
+            auto end()
+                -> iterator
+            {
+                return { state_.get(), state_->size };
+            }
+
+            auto size() const
+                -> size_type
+            {
+                return static_cast<size_type>(state_->size);
+            }
+
+            auto empty() const
+                -> bool
+            {
+                return state_->size == 0;
+            }
+
+            // Element that would be at position pos if the whole
+            // collection was sorted
+            auto operator[](difference_type pos)
+                -> reference
+            {
+                return state_->at(pos);
+            }
+
+            // Number of elements already in their sorted position
+            auto sorted_size() const
+                -> size_type
+            {
+                return static_cast<size_type>(state_->sorter.sorted_end());
+            }
+
+        private:
+
+            std::unique_ptr<state_type> state_;
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Construction functions
+
+    template<
+        typename RandomAccessIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+        >
+    >
+    auto make_lazy_sorted_view(RandomAccessIterator first, RandomAccessIterator last,
+                               Compare compare={}, Projection projection={})
+        -> lazy_sorted_view<RandomAccessIterator, Compare, Projection>
+    {
+        return { std::move(first), std::move(last), std::move(compare), std::move(projection) };
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto make_lazy_sorted_view(RandomAccessIterable& iterable,
+                               Compare compare={}, Projection projection={})
+        -> lazy_sorted_view<decltype(std::begin(iterable)), Compare, Projection>
+    {
+        return { std::begin(iterable), std::end(iterable), std::move(compare), std::move(projection) };
+    }
+}}
+
+#endif // CPPSORT_UTILITY_LAZY_SORTED_VIEW_H_
@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_SEGMENTED_SORT_H_
+#define CPPSORT_UTILITY_SEGMENTED_SORT_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <functional>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/sorter_traits.h>
+#include <cpp-sort/utility/functional.h>
+#include "../detail/functional.h"
+#include "../detail/insertion_sort.h"
+#include "../detail/iterator_traits.h"
+#include "../detail/network_small_sort.h"
+#include "../detail/pdqsort.h"
+#include "../detail/ska_sort.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    namespace detail
+    {
+        // Segments up to that size are sorted with insertion sort
+        // when sorting networks can't be used, same threshold as
+        // pdqsort
+        constexpr std::ptrdiff_t segmented_small_max_size = 24;
+
+        // ska_sort is only worth it for big enough segments
+        constexpr std::ptrdiff_t segmented_radix_min_size = 256;
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_big_segment(std::true_type, RandomAccessIterator first, RandomAccessIterator last,
+                              Compare compare, Projection projection)
+            -> void
+        {
+            if (last - first >= segmented_radix_min_size) {
+                cppsort::detail::ska_sort(first, last, std::move(projection));
+            } else {
+                cppsort::detail::pdqsort(first, last, std::move(compare), std::move(projection));
+            }
+        }
+
+        template<typename RandomAccessIterator, typename Compare, typename Projection>
+        auto sort_big_segment(std::false_type, RandomAccessIterator first, RandomAccessIterator last,
+                              Compare compare, Projection projection)
+            -> void
+        {
+            cppsort::detail::pdqsort(first, last, std::move(compare), std::move(projection));
+        }
+
+        template<typename RandomAccessIterator, typename OffsetIterator,
+                 typename Compare, typename Projection>
+        auto segmented_sort(RandomAccessIterator first,
+                            OffsetIterator offsets_first, OffsetIterator offsets_last,
+                            Compare compare, Projection projection)
+            -> void
+        {
+            using difference_type = cppsort::detail::difference_type_t<RandomAccessIterator>;
+            using projected_type = cppsort::detail::projected_t<RandomAccessIterator, Projection>;
+            using use_networks = cppsort::detail::use_network_small_sort<
+                RandomAccessIterator, Compare, Projection
+            >;
+            using use_radix = std::integral_constant<bool,
+                cppsort::detail::is_ska_sortable_v<projected_type> &&
+                cppsort::detail::is_natural_less<Compare, projected_type>::value
+            >;
+
+            if (offsets_first == offsets_last) return;
+
+            auto segment_begin = static_cast<difference_type>(*offsets_first);
+            while (++offsets_first != offsets_last) {
+                auto segment_end = static_cast<difference_type>(*offsets_first);
+                auto size = segment_end - segment_begin;
+                auto segment_first = first + segment_begin;
+
+                if (size < 2) {
+                    // Nothing to sort
+                } else if (cppsort::detail::network_small_sort(use_networks{},
+                                                               segment_first, first + segment_end,
+                                                               compare, projection)) {
+                    // Sorted with a sorting network
+                } else if (size <= segmented_small_max_size) {
+                    cppsort::detail::insertion_sort(segment_first, first + segment_end,
+                                                    compare, projection);
+                } else {
+                    sort_big_segment(use_radix{}, segment_first, first + segment_end,
+                                     compare, projection);
+                }
+                segment_begin = segment_end;
+            }
+        }
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Sort independently every segment of a collection described
+    // by an array of offsets, as found in the compressed sparse
+    // row format: the n-th segment is [offsets[n], offsets[n+1])
+
+    template<
+        typename RandomAccessIterator,
+        typename OffsetIterator,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_iterator_v<Projection, RandomAccessIterator, Compare>
+        >
+    >
+    auto segmented_sort(RandomAccessIterator first,
+                        OffsetIterator offsets_first, OffsetIterator offsets_last,
+                        Compare compare={}, Projection projection={})
+        -> void
+    {
+        detail::segmented_sort(std::move(first), std::move(offsets_first), std::move(offsets_last),
+                               std::move(compare), std::move(projection));
+    }
+
+    template<
+        typename RandomAccessIterable,
+        typename OffsetIterable,
+        typename Compare = std::less<>,
+        typename Projection = utility::identity,
+        typename = cppsort::detail::enable_if_t<
+            is_projection_v<Projection, RandomAccessIterable, Compare>
+        >
+    >
+    auto segmented_sort(RandomAccessIterable&& iterable, const OffsetIterable& offsets,
+                        Compare compare={}, Projection projection={})
+        -> void
+    {
+        detail::segmented_sort(std::begin(iterable), std::begin(offsets), std::end(offsets),
+                               std::move(compare), std::move(projection));
+    }
+}}
+
+#endif // CPPSORT_UTILITY_SEGMENTED_SORT_H_
@@ -13,6 +13,8 @@
 #include <functional>
 #include <utility>
 #include <cpp-sort/utility/functional.h>
+#include "../detail/config.h"
+#include "../detail/make_array.h"
 #include "../detail/swap_if.h"
 
 namespace cppsort
@@ -43,6 +45,7 @@ namespace utility
         typename Compare = std::less<>,
         typename Projection = utility::identity
     >
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_index_pairs(RandomAccessIterator first, const std::array<index_pair<IndexType>, N>& index_pairs,
                           Compare compare={}, Projection projection={})
         -> void
@@ -110,6 +113,7 @@ namespace utility
         typename Compare = std::less<>,
         typename Projection = utility::identity
     >
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_index_pairs_force_unroll(RandomAccessIterator first,
                                        const std::array<index_pair<IndexType>, N>& index_pairs,
                                        Compare compare={}, Projection projection={})
@@ -119,10 +123,244 @@ namespace utility
     }
 
     template<typename RandomAccessIterator, typename IndexType, typename Compare, typename Projection>
+    CPPSORT_CONSTEXPR_AFTER_CXX17
     auto swap_index_pairs_force_unroll(RandomAccessIterator, const std::array<index_pair<IndexType>, 0>&,
                                        Compare, Projection)
         -> void
     {}
+    ////////////////////////////////////////////////////////////
+    // Sorting network generation
+    //
+    // The following functions generate at compile time the index
+    // pairs of classic sorting networks for any number of inputs.
+    // The networks are generated for the next power of 2, then
+    // the index pairs involving the extra inputs are dropped:
+    // those inputs would always hold values greater than every
+    // real input, so the corresponding compare-exchanges would
+    // never swap anything.
+    //
+    // The index pairs are returned ordered by layer: the index
+    // pairs of a given layer don't share any index, which lets
+    // the processor execute their compare-exchanges in parallel.
+
+    namespace detail
+    {
+        // Index pairs are first generated as std::ptrdiff_t, then
+        // converted to the requested index type once ordered
+        using raw_index_pair = index_pair<std::ptrdiff_t>;
+
+        constexpr auto next_power_of_2(std::ptrdiff_t n) noexcept
+            -> std::ptrdiff_t
+        {
+            std::ptrdiff_t res = 1;
+            while (res < n) {
+                res *= 2;
+            }
+            return res;
+        }
+
+        // Only counts the index pairs when out is null
+        constexpr auto add_index_pair(raw_index_pair* out, std::size_t& size,
+                                      std::ptrdiff_t nb_inputs,
+                                      std::ptrdiff_t first, std::ptrdiff_t second) noexcept
+            -> void
+        {
+            if (second >= nb_inputs) return;
+            if (out != nullptr) {
+                out[size] = { first, second };
+            }
+            ++size;
+        }
+
+        // Bitonic sorter where every compare-exchange puts the
+        // smallest element first: the first stage of each merge
+        // compares the elements of the two halves in mirror order
+        constexpr auto bitonic_network(std::ptrdiff_t n, raw_index_pair* out) noexcept
+            -> std::size_t
+        {
+            std::size_t size = 0;
+            auto pow2 = next_power_of_2(n);
+            for (std::ptrdiff_t p = 1 ; p < pow2 ; p *= 2) {
+                for (std::ptrdiff_t start = 0 ; start < pow2 ; start += 2 * p) {
+                    for (std::ptrdiff_t i = 0 ; i < p ; ++i) {
+                        add_index_pair(out, size, n, start + i, start + 2 * p - 1 - i);
+                    }
+                }
+                for (auto k = p / 2 ; k > 0 ; k /= 2) {
+                    for (std::ptrdiff_t start = 0 ; start < pow2 ; start += 2 * k) {
+                        for (std::ptrdiff_t i = 0 ; i < k ; ++i) {
+                            add_index_pair(out, size, n, start + i, start + i + k);
+                        }
+                    }
+                }
+            }
+            return size;
+        }
+
+        // Batcher's odd-even merge sort
+        constexpr auto odd_even_merge_network(std::ptrdiff_t n, raw_index_pair* out) noexcept
+            -> std::size_t
+        {
+            std::size_t size = 0;
+            auto pow2 = next_power_of_2(n);
+            for (std::ptrdiff_t p = 1 ; p < pow2 ; p *= 2) {
+                for (auto k = p ; k > 0 ; k /= 2) {
+                    for (auto j = k % p ; j < pow2 - k ; j += 2 * k) {
+                        for (std::ptrdiff_t i = 0 ; i < k ; ++i) {
+                            if ((i + j) / (p * 2) == (i + j + k) / (p * 2)) {
+                                add_index_pair(out, size, n, i + j, i + j + k);
+                            }
+                        }
+                    }
+                }
+            }
+            return size;
+        }
+
+        // Parberry's pairwise sorting network
+        constexpr auto pairwise_network(std::ptrdiff_t n, raw_index_pair* out) noexcept
+            -> std::size_t
+        {
+            std::size_t size = 0;
+            auto pow2 = next_power_of_2(n);
+
+            std::ptrdiff_t a = 1;
+            for (; a < pow2 ; a *= 2) {
+                std::ptrdiff_t c = 0;
+                for (auto b = a ; b < pow2 ;) {
+                    add_index_pair(out, size, n, b - a, b);
+                    ++b;
+                    c = (c + 1) % a;
+                    if (c == 0) {
+                        b += a;
+                    }
+                }
+            }
+
+            a /= 4;
+            for (std::ptrdiff_t e = 1 ; a > 0 ; a /= 2, e = 2 * e + 1) {
+                for (auto d = e ; d > 0 ; d /= 2) {
+                    std::ptrdiff_t c = 0;
+                    for (auto b = (d + 1) * a ; b < pow2 ;) {
+                        add_index_pair(out, size, n, b - d * a, b);
+                        ++b;
+                        c = (c + 1) % a;
+                        if (c == 0) {
+                            b += a;
+                        }
+                    }
+                }
+            }
+            return size;
+        }
+
+        // Batcher's odd-even merge of two sorted runs [0, m) and
+        // [m, m + n): the merge network for two runs of the next
+        // power of 2 is generated as if the first run was padded
+        // with smaller values at its front and the second one with
+        // greater values at its back, then the index pairs involving
+        // the padding are dropped
+        constexpr auto odd_even_merge_runs_network(std::ptrdiff_t m, std::ptrdiff_t n,
+                                                   raw_index_pair* out) noexcept
+            -> std::size_t
+        {
+            std::size_t size = 0;
+            auto half = next_power_of_2(m < n ? n : m);
+            auto offset = half - m;
+            for (auto k = half ; k > 0 ; k /= 2) {
+                for (auto j = k % half ; j < 2 * half - k ; j += 2 * k) {
+                    for (std::ptrdiff_t i = 0 ; i < k ; ++i) {
+                        if (i + j >= offset) {
+                            add_index_pair(out, size, m + n, i + j - offset, i + j + k - offset);
+                        }
+                    }
+                }
+            }
+            return size;
+        }
+
+        // Reorder the index pairs of a comparator network by layer,
+        // the layer of a pair being the earliest one it can be part
+        // of: the relative order of pairs sharing an index doesn't
+        // change, which means that the network is left unchanged
+        template<typename IndexType, std::size_t NbInputs, std::size_t Size>
+        constexpr auto order_by_layer(const raw_index_pair* pairs)
+            -> std::array<index_pair<IndexType>, Size>
+        {
+            std::ptrdiff_t depths[NbInputs] = {};
+            std::ptrdiff_t layers[Size] = {};
+            std::ptrdiff_t nb_layers = 0;
+            for (std::size_t i = 0 ; i < Size ; ++i) {
+                auto& first_depth = depths[pairs[i].first];
+                auto& second_depth = depths[pairs[i].second];
+                auto layer = first_depth < second_depth ? second_depth : first_depth;
+                layers[i] = layer;
+                first_depth = second_depth = layer + 1;
+                if (nb_layers < layer + 1) {
+                    nb_layers = layer + 1;
+                }
+            }
+
+            index_pair<IndexType> res[Size] = {};
+            std::size_t pos = 0;
+            for (std::ptrdiff_t layer = 0 ; layer < nb_layers ; ++layer) {
+                for (std::size_t i = 0 ; i < Size ; ++i) {
+                    if (layers[i] == layer) {
+                        res[pos] = {
+                            static_cast<IndexType>(pairs[i].first),
+                            static_cast<IndexType>(pairs[i].second)
+                        };
+                        ++pos;
+                    }
+                }
+            }
+            return cppsort::detail::make_array(res);
+        }
+
+        template<typename IndexType, std::size_t N, std::size_t Size, typename Generator>
+        constexpr auto generate_network(Generator generator, std::false_type)
+            -> std::array<index_pair<IndexType>, Size>
+        {
+            raw_index_pair pairs[Size] = {};
+            generator(N, pairs);
+            return order_by_layer<IndexType, N, Size>(pairs);
+        }
+
+        template<typename IndexType, std::size_t N, std::size_t Size, typename Generator>
+        constexpr auto generate_network(Generator, std::true_type)
+            -> std::array<index_pair<IndexType>, Size>
+        {
+            // Networks for 0 or 1 input are empty
+            return {};
+        }
+    }
+
+    template<std::size_t N, typename IndexType=std::ptrdiff_t>
+    constexpr auto bitonic_network_pairs()
+        -> std::array<index_pair<IndexType>, detail::bitonic_network(N, nullptr)>
+    {
+        return detail::generate_network<IndexType, N, detail::bitonic_network(N, nullptr)>(
+            detail::bitonic_network, std::integral_constant<bool, (N < 2)>{}
+        );
+    }
+
+    template<std::size_t N, typename IndexType=std::ptrdiff_t>
+    constexpr auto odd_even_merge_network_pairs()
+        -> std::array<index_pair<IndexType>, detail::odd_even_merge_network(N, nullptr)>
+    {
+        return detail::generate_network<IndexType, N, detail::odd_even_merge_network(N, nullptr)>(
+            detail::odd_even_merge_network, std::integral_constant<bool, (N < 2)>{}
+        );
+    }
+
+    template<std::size_t N, typename IndexType=std::ptrdiff_t>
+    constexpr auto pairwise_network_pairs()
+        -> std::array<index_pair<IndexType>, detail::pairwise_network(N, nullptr)>
+    {
+        return detail::generate_network<IndexType, N, detail::pairwise_network(N, nullptr)>(
+            detail::pairwise_network, std::integral_constant<bool, (N < 2)>{}
+        );
+    }
 }}
 
 #endif // CPPSORT_UTILITY_SORTING_NETWORKS_H_
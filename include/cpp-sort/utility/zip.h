@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#ifndef CPPSORT_UTILITY_ZIP_H_
+#define CPPSORT_UTILITY_ZIP_H_
+
+////////////////////////////////////////////////////////////
+// Headers
+////////////////////////////////////////////////////////////
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <cpp-sort/utility/iter_move.h>
+#include <cpp-sort/utility/size.h>
+#include "../detail/iterator_traits.h"
+#include "../detail/type_traits.h"
+
+namespace cppsort
+{
+namespace utility
+{
+    ////////////////////////////////////////////////////////////
+    // Proxy reference: tuple of references to the elements at
+    // the same position in every zipped collection
+    //
+    // Assigning to it assigns the referenced elements, and it
+    // compares like a tuple, either against another reference
+    // or against the value type of the zip iterator. It is also
+    // compatible with std::get, which makes it easy to write
+    // projections that only look at one of the collections.
+
+    template<typename... References>
+    class zip_reference:
+        public std::tuple<References...>
+    {
+        private:
+
+            using base_type = std::tuple<References...>;
+
+        public:
+
+            using base_type::base_type;
+            using base_type::operator=;
+
+            zip_reference(const zip_reference&) = default;
+            zip_reference(zip_reference&&) = default;
+
+            // Assign the referenced elements, not the references
+            auto operator=(const zip_reference& other)
+                -> zip_reference&
+            {
+                base_type::operator=(static_cast<const base_type&>(other));
+                return *this;
+            }
+
+            auto operator=(zip_reference&& other)
+                -> zip_reference&
+            {
+                base_type::operator=(static_cast<const base_type&>(other));
+                return *this;
+            }
+
+            // Proxy references are prvalues, swapping them swaps
+            // the referenced elements
+            friend auto swap(zip_reference lhs, zip_reference rhs)
+                -> void
+            {
+                swap_elements(lhs, rhs, std::index_sequence_for<References...>{});
+            }
+
+        private:
+
+            template<std::size_t... Indices>
+            static auto swap_elements(zip_reference& lhs, zip_reference& rhs,
+                                      std::index_sequence<Indices...>)
+                -> void
+            {
+                using std::swap;
+                (void) std::initializer_list<int>{
+                    (swap(std::get<Indices>(lhs), std::get<Indices>(rhs)), 0)...
+                };
+            }
+    };
+
+    ////////////////////////////////////////////////////////////
+    // Random-access iterator advancing several random-access
+    // iterators in lockstep
+
+    template<typename... Iterators>
+    class zip_iterator
+    {
+        static_assert(sizeof...(Iterators) > 0,
+                      "zip_iterator needs at least one iterator");
+
+        public:
+
+            ////////////////////////////////////////////////////////////
+            // Public types
+
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type        = std::tuple<cppsort::detail::value_type_t<Iterators>...>;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = zip_reference<cppsort::detail::reference_t<Iterators>...>;
+
+            ////////////////////////////////////////////////////////////
+            // Constructors
+
+            zip_iterator() = default;
+
+            constexpr explicit zip_iterator(Iterators... iterators):
+                iterators_(std::move(iterators)...)
+            {}
+
+            ////////////////////////////////////////////////////////////
+            // Members access
+
+            constexpr auto base() const
+                -> const std::tuple<Iterators...>&
+            {
+                return iterators_;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Element access
+
+            auto operator*() const
+                -> reference
+            {
+                return dereference(std::index_sequence_for<Iterators...>{});
+            }
+
+            auto operator[](difference_type pos) const
+                -> reference
+            {
+                return *(*this + pos);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Increment/decrement operators
+
+            auto operator++()
+                -> zip_iterator&
+            {
+                advance(1, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            auto operator++(int)
+                -> zip_iterator
+            {
+                auto tmp = *this;
+                operator++();
+                return tmp;
+            }
+
+            auto operator--()
+                -> zip_iterator&
+            {
+                advance(-1, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            auto operator--(int)
+                -> zip_iterator
+            {
+                auto tmp = *this;
+                operator--();
+                return tmp;
+            }
+
+            auto operator+=(difference_type increment)
+                -> zip_iterator&
+            {
+                advance(increment, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            auto operator-=(difference_type increment)
+                -> zip_iterator&
+            {
+                advance(-increment, std::index_sequence_for<Iterators...>{});
+                return *this;
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Comparison operators: the iterators always move in
+            // lockstep, comparing the first ones is enough
+
+            friend constexpr auto operator==(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.iterators_) == std::get<0>(rhs.iterators_);
+            }
+
+            friend constexpr auto operator!=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.iterators_) != std::get<0>(rhs.iterators_);
+            }
+
+            friend constexpr auto operator<(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.iterators_) < std::get<0>(rhs.iterators_);
+            }
+
+            friend constexpr auto operator<=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.iterators_) <= std::get<0>(rhs.iterators_);
+            }
+
+            friend constexpr auto operator>(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.iterators_) > std::get<0>(rhs.iterators_);
+            }
+
+            friend constexpr auto operator>=(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> bool
+            {
+                return std::get<0>(lhs.iterators_) >= std::get<0>(rhs.iterators_);
+            }
+
+            ////////////////////////////////////////////////////////////
+            // Arithmetic operators
+
+            friend auto operator+(zip_iterator it, difference_type size)
+                -> zip_iterator
+            {
+                it += size;
+                return it;
+            }
+
+            friend auto operator+(difference_type size, zip_iterator it)
+                -> zip_iterator
+            {
+                it += size;
+                return it;
+            }
+
+            friend auto operator-(zip_iterator it, difference_type size)
+                -> zip_iterator
+            {
+                it -= size;
+                return it;
+            }
+
+            friend constexpr auto operator-(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> difference_type
+            {
+                return static_cast<difference_type>(
+                    std::get<0>(lhs.iterators_) - std::get<0>(rhs.iterators_)
+                );
+            }
+
+            ////////////////////////////////////////////////////////////
+            // iter_move/iter_swap
+
+            // Move the elements out of the collections: returning a
+            // tuple of rvalue references instead would make the
+            // temporary values of the sorting algorithms alias the
+            // elements they are supposed to save
+            friend auto iter_move(const zip_iterator& it)
+                -> value_type
+            {
+                return it.move_elements(std::index_sequence_for<Iterators...>{});
+            }
+
+            friend auto iter_swap(const zip_iterator& lhs, const zip_iterator& rhs)
+                -> void
+            {
+                lhs.swap_elements(rhs, std::index_sequence_for<Iterators...>{});
+            }
+
+        private:
+
+            template<std::size_t... Indices>
+            auto dereference(std::index_sequence<Indices...>) const
+                -> reference
+            {
+                return reference(*std::get<Indices>(iterators_)...);
+            }
+
+            template<std::size_t... Indices>
+            auto advance(difference_type increment, std::index_sequence<Indices...>)
+                -> void
+            {
+                (void) std::initializer_list<int>{
+                    (std::get<Indices>(iterators_) += increment, 0)...
+                };
+            }
+
+            template<std::size_t... Indices>
+            auto move_elements(std::index_sequence<Indices...>) const
+                -> value_type
+            {
+                using utility::iter_move;
+                return value_type(iter_move(std::get<Indices>(iterators_))...);
+            }
+
+            template<std::size_t... Indices>
+            auto swap_elements(const zip_iterator& other, std::index_sequence<Indices...>) const
+                -> void
+            {
+                using utility::iter_swap;
+                (void) std::initializer_list<int>{
+                    (iter_swap(std::get<Indices>(iterators_), std::get<Indices>(other.iterators_)), 0)...
+                };
+            }
+
+            std::tuple<Iterators...> iterators_;
+    };
+
+    template<typename... Iterators>
+    auto make_zip_iterator(Iterators... iterators)
+        -> zip_iterator<Iterators...>
+    {
+        return zip_iterator<Iterators...>(std::move(iterators)...);
+    }
+
+    ////////////////////////////////////////////////////////////
+    // Range over several random-access collections of the same
+    // size, viewed as a single collection of tuples
+
+    template<typename... Iterators>
+    class zip_range
+    {
+        public:
+
+            using iterator = zip_iterator<Iterators...>;
+
+            zip_range(iterator first, iterator last):
+                first_(std::move(first)),
+                last_(std::move(last))
+            {}
+
+            auto begin() const
+                -> iterator
+            {
+                return first_;
+            }
+
+            auto end() const
+                -> iterator
+            {
+                return last_;
+            }
+
+            auto size() const
+                -> std::size_t
+            {
+                return static_cast<std::size_t>(last_ - first_);
+            }
+
+        private:
+
+            iterator first_;
+            iterator last_;
+    };
+
+    template<typename... Iterables>
+    auto zip(Iterables&... iterables)
+        -> zip_range<decltype(std::begin(iterables))...>
+    {
+        // The range stops at the end of the smallest collection
+        auto size = (std::min)({ static_cast<std::ptrdiff_t>(utility::size(iterables))... });
+        return {
+            make_zip_iterator(std::begin(iterables)...),
+            make_zip_iterator(std::begin(iterables)...) + size
+        };
+    }
+}}
+
+#endif // CPPSORT_UTILITY_ZIP_H_
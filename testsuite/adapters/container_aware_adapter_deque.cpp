@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/container_aware_adapter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "container_aware_adapter and std::deque",
+           "[container_aware_adapter]" )
+{
+    // Tests for the sorters that have container-aware
+    // overloads for std::deque, both with deques that
+    // fit in a single block and deques spanning many
+
+    auto size = GENERATE(as<int>{}, 10, 187, 10000);
+    std::vector<double> vec; vec.reserve(size);
+    auto distribution = dist::shuffled{};
+    distribution.call<double>(std::back_inserter(vec), size, -24);
+
+    SECTION( "pdq_sorter" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::pdq_sorter
+        > sorter;
+        std::deque<double> collection(std::begin(vec), std::end(vec));
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::negate<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::greater<>{}, std::negate<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        // Elements that are not trivially copyable
+
+        std::deque<std::string> strings;
+        for (auto value: vec) {
+            strings.push_back(std::to_string(value));
+        }
+        sorter(strings);
+        CHECK( std::is_sorted(std::begin(strings), std::end(strings)) );
+    }
+
+    SECTION( "ska_sorter" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::ska_sorter
+        > sorter;
+        std::deque<double> collection(std::begin(vec), std::end(vec));
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::negate<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+    }
+}
@@ -12,7 +12,9 @@
 #include <cpp-sort/sorters/insertion_sorter.h>
 #include <cpp-sort/sorters/mel_sorter.h>
 #include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
 #include <cpp-sort/sorters/selection_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
 #include <testing-tools/distributions.h>
 
 TEST_CASE( "container_aware_adapter and std::forward_list",
@@ -103,6 +105,45 @@ TEST_CASE( "container_aware_adapter and std::forward_list",
         CHECK( std::is_sorted(vec_copy.begin(), vec_copy.end()) );
     }
 
+    SECTION( "pdq_sorter" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::pdq_sorter
+        > sorter;
+        std::forward_list<double> collection(std::begin(vec), std::end(vec));
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::negate<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::greater<>{}, std::negate<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        // Nodes are relinked, iterators remain valid
+
+        collection = { std::begin(vec), std::end(vec) };
+        auto it = std::begin(collection);
+        auto value = *it;
+        sorter(collection);
+        CHECK( *it == value );
+        CHECK( std::is_sorted(it, std::end(collection)) );
+
+        // Make sure that the generic overload is also called when needed
+
+        auto vec_copy = vec;
+        sorter(vec_copy);
+        CHECK( std::is_sorted(std::begin(vec_copy), std::end(vec_copy)) );
+    }
+
     SECTION( "selection_sorter" )
     {
         cppsort::container_aware_adapter<
@@ -128,4 +169,79 @@ TEST_CASE( "container_aware_adapter and std::forward_list",
         sorter(vec_copy);
         CHECK( std::is_sorted(std::begin(vec_copy), std::end(vec_copy)) );
     }
+
+    SECTION( "ska_sorter" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::ska_sorter
+        > sorter;
+        std::forward_list<double> collection(std::begin(vec), std::end(vec));
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        collection = { std::begin(vec), std::end(vec) };
+        sorter(collection, std::negate<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        // Make sure that the generic overload is also called when needed
+
+        auto vec_copy = vec;
+        sorter(vec_copy);
+        CHECK( std::is_sorted(std::begin(vec_copy), std::end(vec_copy)) );
+    }
+}
+
+TEST_CASE( "container_aware_adapter and std::forward_list with a throwing comparison",
+           "[container_aware_adapter][exception]" )
+{
+    // Node-based algorithms must not lose elements when the
+    // comparison throws in the middle of the sort
+
+    std::vector<int> vec; vec.reserve(1000);
+    auto distribution = dist::shuffled{};
+    distribution.call<int>(std::back_inserter(vec), 1000);
+
+    struct comparison_error {};
+    auto make_compare = [](int& calls) {
+        return [&calls](int lhs, int rhs) {
+            if (++calls == 500) {
+                throw comparison_error{};
+            }
+            return lhs < rhs;
+        };
+    };
+
+    SECTION( "pdq_sorter" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::pdq_sorter
+        > sorter;
+        std::forward_list<int> collection(vec.begin(), vec.end());
+
+        int calls = 0;
+        CHECK_THROWS_AS( sorter(collection, make_compare(calls)), comparison_error );
+        CHECK( std::distance(collection.begin(), collection.end()) == 1000 );
+        CHECK( std::is_permutation(collection.begin(), collection.end(), vec.begin(), vec.end()) );
+    }
+
+    SECTION( "ska_sorter" )
+    {
+        cppsort::container_aware_adapter<
+            cppsort::ska_sorter
+        > sorter;
+        std::forward_list<int> collection(vec.begin(), vec.end());
+
+        int calls = 0;
+        auto projection = [&calls](int value) {
+            if (++calls == 500) {
+                throw comparison_error{};
+            }
+            return value;
+        };
+        CHECK_THROWS_AS( sorter(collection, projection), comparison_error );
+        CHECK( std::distance(collection.begin(), collection.end()) == 1000 );
+        CHECK( std::is_permutation(collection.begin(), collection.end(), vec.begin(), vec.end()) );
+    }
 }
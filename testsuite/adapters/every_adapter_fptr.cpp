@@ -177,6 +177,33 @@ TEST_CASE( "function pointer test for every adapter",
         CHECK( std::is_sorted(std::begin(to_sort), std::end(to_sort), std::greater<>{}) );
     }
 
+    SECTION( "small_collection_adapter" )
+    {
+        using sorter = cppsort::small_collection_adapter<
+            cppsort::low_comparisons_sorter,
+            cppsort::poplar_sorter
+        >;
+        constexpr void(*sort_it)(std::vector<short int>&, std::greater<>) = sorter{};
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        std::vector<short int> small_collection = { 4, 3, 2, 5, 6, 1 };
+        sort_it(small_collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(small_collection), std::end(small_collection), std::greater<>{}) );
+    }
+
+    SECTION( "sorted_prefix_adapter" )
+    {
+        using sorter = cppsort::sorted_prefix_adapter<
+            cppsort::poplar_sorter
+        >;
+        constexpr void(*sort_it)(std::vector<short int>&, std::greater<>) = sorter{};
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+    }
+
     SECTION( "stable_adapter" )
     {
         using sorter = cppsort::stable_adapter<
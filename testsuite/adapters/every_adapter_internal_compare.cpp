@@ -36,6 +36,16 @@ TEST_CASE( "test most adapters with a pointer to member function comparison",
         CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
     }
 
+    SECTION( "external_adapter" )
+    {
+        using sorter = cppsort::external_adapter<
+            cppsort::poplar_sorter
+        >;
+
+        sorter(cppsort::poplar_sort, 16 * sizeof(int))(collection, &internal_compare<int>::compare_to);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+    }
+
     SECTION( "hybrid_adapter" )
     {
         using sorter = cppsort::hybrid_adapter<
@@ -134,6 +144,31 @@ TEST_CASE( "test most adapters with a pointer to member function comparison",
         CHECK( std::is_sorted(std::begin(to_sort), std::end(to_sort)) );
     }
 
+    SECTION( "small_collection_adapter" )
+    {
+        using sorter = cppsort::small_collection_adapter<
+            cppsort::sorting_network_sorter,
+            cppsort::poplar_sorter
+        >;
+
+        sorter{}(collection, &internal_compare<int>::compare_to);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+
+        std::vector<internal_compare<int>> small_collection = { {4}, {3}, {2}, {5}, {6}, {1} };
+        sorter{}(small_collection, &internal_compare<int>::compare_to);
+        CHECK( std::is_sorted(std::begin(small_collection), std::end(small_collection)) );
+    }
+
+    SECTION( "sorted_prefix_adapter" )
+    {
+        using sorter = cppsort::sorted_prefix_adapter<
+            cppsort::poplar_sorter
+        >;
+
+        sorter{}(collection, &internal_compare<int>::compare_to);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+    }
+
     SECTION( "stable_adapter" )
     {
         using sorter = cppsort::stable_adapter<
@@ -51,6 +51,16 @@ TEST_CASE( "test adapters extended compatibility with LWG 3031", "[adapters]" )
         CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
     }
 
+    SECTION( "external_adapter" )
+    {
+        using sorter = cppsort::external_adapter<
+            cppsort::poplar_sorter
+        >;
+
+        sorter(cppsort::poplar_sort, 16 * sizeof(int))(vec, non_const_compare);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
+
     SECTION( "hybrid_adapter" )
     {
         using sorter = cppsort::hybrid_adapter<
@@ -140,6 +150,31 @@ TEST_CASE( "test adapters extended compatibility with LWG 3031", "[adapters]" )
         CHECK( std::is_sorted(std::begin(to_sort), std::end(to_sort)) );
     }
 
+    SECTION( "small_collection_adapter" )
+    {
+        using sorter = cppsort::small_collection_adapter<
+            cppsort::sorting_network_sorter,
+            cppsort::poplar_sorter
+        >;
+
+        sorter{}(vec, non_const_compare);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+
+        std::vector<int> small_vec = { 4, 3, 2, 5, 6, 1 };
+        sorter{}(small_vec, non_const_compare);
+        CHECK( std::is_sorted(std::begin(small_vec), std::end(small_vec)) );
+    }
+
+    SECTION( "sorted_prefix_adapter" )
+    {
+        using sorter = cppsort::sorted_prefix_adapter<
+            cppsort::poplar_sorter
+        >;
+
+        sorter{}(vec, non_const_compare);
+        CHECK( std::is_sorted(std::begin(vec), std::end(vec)) );
+    }
+
     SECTION( "stable_adapter" )
     {
         using sorter = cppsort::stable_adapter<
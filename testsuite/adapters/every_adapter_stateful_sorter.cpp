@@ -98,6 +98,18 @@ TEST_CASE( "test stateful sorters with every adapter",
         CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
     }
 
+    SECTION( "external_adapter" )
+    {
+        stateful_sorter<> sorter(42);
+        cppsort::external_adapter<stateful_sorter<>> sort_it(sorter, 4 * sizeof(short int));
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+
+        sort_it(fli, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(fli), std::end(fli), std::greater<>{}) );
+    }
+
     SECTION( "hybrid_adapter" )
     {
         stateful_sorter<std::forward_iterator_tag> sorter1(41);
@@ -181,6 +193,27 @@ TEST_CASE( "test stateful sorters with every adapter",
         CHECK( std::is_sorted(std::begin(li), std::end(li), std::greater<>{}) );
     }
 
+    SECTION( "small_collection_adapter" )
+    {
+        stateful_sorter<> sorter(42);
+        cppsort::small_collection_adapter<
+            cppsort::low_comparisons_sorter,
+            stateful_sorter<>
+        > sort_it(sorter);
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+    }
+
+    SECTION( "sorted_prefix_adapter" )
+    {
+        stateful_sorter<> sorter(42);
+        cppsort::sorted_prefix_adapter<stateful_sorter<>> sort_it(sorter);
+
+        sort_it(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+    }
+
     SECTION( "stable_adapter" )
     {
         stateful_sorter<> sorter(42);
@@ -7,14 +7,18 @@
 #include <iterator>
 #include <catch2/catch.hpp>
 #include <cpp-sort/adapters.h>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
 #include <cpp-sort/sorters/poplar_sorter.h>
 #include <testing-tools/distributions.h>
 #include <testing-tools/test_vector.h>
 
 TEMPLATE_TEST_CASE( "test adapters with an int8_t difference_type", "[adapters]",
+                    cppsort::external_adapter<cppsort::poplar_sorter>,
                     cppsort::indirect_adapter<cppsort::poplar_sorter>,
                     cppsort::out_of_place_adapter<cppsort::poplar_sorter>,
                     cppsort::schwartz_adapter<cppsort::poplar_sorter>,
+                    (cppsort::small_collection_adapter<cppsort::sorting_network_sorter, cppsort::poplar_sorter>),
+                    cppsort::sorted_prefix_adapter<cppsort::poplar_sorter>,
                     cppsort::stable_adapter<cppsort::poplar_sorter>,
                     cppsort::verge_adapter<cppsort::poplar_sorter>
                      )
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/external_adapter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "external_adapter tests", "[external_adapter]" )
+{
+    auto distribution = dist::shuffled{};
+
+    SECTION( "collection that fits in memory" )
+    {
+        cppsort::external_adapter<cppsort::pdq_sorter> sorter;
+
+        std::vector<int> vec;
+        distribution(std::back_inserter(vec), 10000, 0);
+        sorter(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "forward iterators that fit in memory" )
+    {
+        // pdq_sorter can't sort the list in place, merge_sorter can
+        cppsort::external_adapter<cppsort::pdq_sorter> pdq_sorter;
+        cppsort::external_adapter<cppsort::merge_sorter> merge_sorter;
+
+        std::list<int> li;
+        distribution(std::back_inserter(li), 1000, 0);
+        pdq_sorter(li);
+        CHECK( std::is_sorted(li.begin(), li.end()) );
+
+        std::forward_list<int> flist;
+        distribution(std::front_inserter(flist), 1000, 0);
+        merge_sorter(flist, std::greater<>{});
+        CHECK( std::is_sorted(flist.begin(), flist.end(), std::greater<>{}) );
+    }
+
+    SECTION( "single merge pass" )
+    {
+        // Runs of 4096 elements, merged in a single pass
+        cppsort::external_adapter<cppsort::pdq_sorter> sorter(cppsort::pdq_sort, 4096 * sizeof(int));
+
+        std::vector<int> vec;
+        distribution(std::back_inserter(vec), 10000, 0);
+        sorter(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+
+        vec.clear();
+        distribution(std::back_inserter(vec), 10000, 0);
+        sorter(vec, std::greater<>{});
+        CHECK( std::is_sorted(vec.begin(), vec.end(), std::greater<>{}) );
+    }
+
+    SECTION( "several merge passes" )
+    {
+        // Runs of 64 elements, too many to be merged at once
+        cppsort::external_adapter<cppsort::ska_sorter> sorter(cppsort::ska_sort, 64 * sizeof(double));
+
+        std::vector<double> vec;
+        distribution.call<double>(std::back_inserter(vec), 10000, 0);
+        sorter(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "bidirectional and forward iterators" )
+    {
+        cppsort::external_adapter<cppsort::pdq_sorter> sorter(cppsort::pdq_sort, 100 * sizeof(int));
+
+        std::list<int> li;
+        distribution(std::back_inserter(li), 1000, 0);
+        sorter(li);
+        CHECK( std::is_sorted(li.begin(), li.end()) );
+
+        std::forward_list<int> flist;
+        distribution(std::front_inserter(flist), 1000, 0);
+        sorter(flist);
+        CHECK( std::is_sorted(flist.begin(), flist.end()) );
+    }
+
+    SECTION( "stability" )
+    {
+        cppsort::external_adapter<cppsort::merge_sorter> sorter(cppsort::merge_sort, 128 * sizeof(generic_stable_wrapper<int>));
+        CHECK( cppsort::is_stable<decltype(sorter)(std::vector<int>&)>::value );
+
+        std::vector<generic_stable_wrapper<int>> vec;
+        auto distribution_16 = dist::shuffled_16_values{};
+        distribution_16(std::back_inserter(vec), 5000);
+        helpers::iota(vec.begin(), vec.end(), 0, &generic_stable_wrapper<int>::order);
+
+        sorter(vec, &generic_stable_wrapper<int>::value);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+}
@@ -1,8 +1,9 @@
 /*
- * Copyright (c) 2016-2020 Morwenn
+ * Copyright (c) 2016-2021 Morwenn
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
+#include <deque>
 #include <functional>
 #include <iterator>
 #include <vector>
@@ -90,3 +91,28 @@ TEST_CASE( "indirect_adapter with temporary span",
         CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
     }
 }
+
+TEST_CASE( "indirect_adapter with non-contiguous random-access collection",
+           "[indirect_adapter]" )
+{
+    std::deque<int> collection;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 221, -32);
+
+    cppsort::indirect_adapter<
+        cppsort::quick_sorter
+    > sorter;
+
+    SECTION( "with comparison" )
+    {
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+    }
+
+    SECTION( "with projection" )
+    {
+        sorter(std::begin(collection), std::end(collection), std::negate<>{});
+        CHECK( helpers::is_sorted(std::begin(collection), std::end(collection),
+                                  std::less<>{}, std::negate<>{}) );
+    }
+}
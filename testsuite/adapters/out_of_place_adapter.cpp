@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/out_of_place_adapter.h>
+#include <cpp-sort/sorter_facade.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/quick_sorter.h>
+#include <cpp-sort/utility/functional.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    ////////////////////////////////////////////////////////////
+    // Sorter returning whether the elements it sorts are
+    // correctly aligned for their type
+
+    struct alignment_checking_sorter_impl
+    {
+        template<
+            typename RandomAccessIterator,
+            typename Projection = cppsort::utility::identity
+        >
+        auto operator()(RandomAccessIterator first, RandomAccessIterator last,
+                        Projection projection={}) const
+            -> bool
+        {
+            using value_type = typename std::iterator_traits<RandomAccessIterator>::value_type;
+            bool aligned = std::all_of(first, last, [](const value_type& value) {
+                auto address = reinterpret_cast<std::uintptr_t>(std::addressof(value));
+                return address % alignof(value_type) == 0;
+            });
+            cppsort::pdq_sort(first, last, projection);
+            return aligned;
+        }
+
+        using iterator_category = std::random_access_iterator_tag;
+        using is_always_stable = std::false_type;
+    };
+
+    struct alignment_checking_sorter:
+        cppsort::sorter_facade<alignment_checking_sorter_impl>
+    {};
+}
+
+TEST_CASE( "out_of_place_adapter with trivially copyable types",
+           "[out_of_place_adapter]" )
+{
+    auto distribution = dist::shuffled{};
+
+    cppsort::out_of_place_adapter<
+        cppsort::pdq_sorter
+    > sorter;
+
+    SECTION( "std::deque" )
+    {
+        std::deque<int> collection;
+        distribution(std::back_inserter(collection), 1551, -32);
+        sorter(collection, std::greater<>{});
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+    }
+
+    SECTION( "std::list" )
+    {
+        std::list<double> collection;
+        distribution(std::back_inserter(collection), 221, -32);
+        sorter(collection, std::negate<>{});
+        CHECK( helpers::is_sorted(std::begin(collection), std::end(collection),
+                                  std::less<>{}, std::negate<>{}) );
+    }
+
+    SECTION( "reuse memory for collections of growing size" )
+    {
+        // 200000 elements need more memory than what is kept
+        // between calls, which is allocated for that call only
+        for (int size : { 10, 1000, 50, 5000, 200000, 25 }) {
+            std::list<long long> collection;
+            distribution(std::back_inserter(collection), size, -32);
+            sorter(collection);
+            CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+        }
+    }
+
+}
+
+#ifdef __cpp_aligned_new
+TEST_CASE( "out_of_place_adapter with over-aligned types",
+           "[out_of_place_adapter]" )
+{
+    // Over-aligned types go through the scratch buffer when
+    // aligned allocation functions are available
+    struct alignas(64) aligned_int
+    {
+        int value;
+    };
+    static_assert(cppsort::detail::can_use_scratch_buffer<aligned_int>::value, "");
+
+    cppsort::out_of_place_adapter<alignment_checking_sorter> sorter;
+    auto distribution = dist::shuffled{};
+
+    // Both sizes allocate over-aligned memory: the first one grows
+    // the memory kept between calls, the second one is too big to
+    // be kept and gets a dedicated allocation
+    for (int size : { 300, 20000 }) {
+        std::vector<int> values;
+        distribution(std::back_inserter(values), size, -32);
+        std::list<aligned_int> collection;
+        for (int value: values) {
+            collection.push_back({value});
+        }
+        bool aligned = sorter(collection, &aligned_int::value);
+        CHECK( aligned );
+        CHECK( helpers::is_sorted(std::begin(collection), std::end(collection),
+                                  std::less<>{}, &aligned_int::value) );
+    }
+}
+#endif
+
+TEST_CASE( "out_of_place_adapter with other types",
+           "[out_of_place_adapter]" )
+{
+    std::list<std::string> collection;
+    for (int i = -125 ; i < 287 ; ++i) {
+        collection.push_back(std::to_string(i));
+    }
+    collection.reverse();
+
+    cppsort::out_of_place_adapter<
+        cppsort::pdq_sorter
+    > sorter;
+    sorter(collection);
+    CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+}
+
+TEST_CASE( "nested out_of_place_adapter",
+           "[out_of_place_adapter]" )
+{
+    std::list<int> collection;
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 853, -32);
+
+    // The inner adapter can't reuse the memory borrowed by the outer one
+    cppsort::out_of_place_adapter<
+        cppsort::out_of_place_adapter<cppsort::quick_sorter>
+    > sorter;
+    sorter(collection, std::greater<>{});
+    CHECK( std::is_sorted(std::begin(collection), std::end(collection), std::greater<>{}) );
+}
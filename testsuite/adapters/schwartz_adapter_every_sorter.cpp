@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
+#include <cstddef>
+#include <deque>
 #include <forward_list>
 #include <functional>
 #include <list>
@@ -151,3 +153,22 @@ TEST_CASE( "type-specific sorters with Schwartzian transform adapter", "[schwart
                                   std::greater<>{}, &wrapper<std::string>::value) );
     }
 }
+
+TEMPLATE_TEST_CASE( "stability of stable sorters with Schwartzian transform adapter", "[schwartz_adapter]",
+                    cppsort::insertion_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::tim_sorter )
+{
+    using wrapper = generic_stable_wrapper<int>;
+
+    std::deque<wrapper> collection;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(collection), 412);
+    for (std::size_t idx = 0 ; idx < collection.size() ; ++idx) {
+        collection[idx].order = static_cast<int>(idx);
+    }
+
+    cppsort::schwartz_adapter<TestType> sorter;
+    sorter(collection, &wrapper::value);
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+}
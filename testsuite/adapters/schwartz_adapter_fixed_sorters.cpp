@@ -57,7 +57,7 @@ TEST_CASE( "Schwartzian transform adapter with fixed-size sorters",
 
     SECTION( "size 1" )
     {
-        std::array<wrapper, 1> collection;
+        std::array<wrapper, 1> collection = {};
 
         low_comparisons_sort(collection, &wrapper::value);
         low_moves_sort(collection, &wrapper::value);
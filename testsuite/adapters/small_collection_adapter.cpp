@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/counting_adapter.h>
+#include <cpp-sort/adapters/small_collection_adapter.h>
+#include <cpp-sort/fixed/low_comparisons_sorter.h>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/selection_sorter.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/random.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "small_collection_adapter tests", "[small_collection_adapter]" )
+{
+    auto distribution = dist::shuffled{};
+
+    SECTION( "every size of the domain and above" )
+    {
+        cppsort::small_collection_adapter<
+            cppsort::sorting_network_sorter,
+            cppsort::pdq_sorter
+        > sorter;
+
+        for (int size = 0 ; size < 80 ; ++size) {
+            std::vector<int> vec(size);
+            std::iota(vec.begin(), vec.end(), 0);
+            std::shuffle(vec.begin(), vec.end(), hasard::engine());
+            sorter(vec);
+            CHECK( std::is_sorted(vec.begin(), vec.end()) );
+        }
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        cppsort::small_collection_adapter<
+            cppsort::low_comparisons_sorter,
+            cppsort::pdq_sorter
+        > sorter;
+        using wrapper = generic_wrapper<int>;
+
+        for (int size = 0 ; size < 20 ; ++size) {
+            std::vector<wrapper> vec(size);
+            std::iota(vec.begin(), vec.end(), 0);
+            std::shuffle(vec.begin(), vec.end(), hasard::engine());
+            sorter(vec, std::greater<>{}, &wrapper::value);
+            CHECK( std::is_sorted(vec.begin(), vec.end(), [](const auto& lhs, const auto& rhs) {
+                return lhs.value > rhs.value;
+            }) );
+        }
+    }
+
+    SECTION( "sizes outside of the explicit indices" )
+    {
+        // Only sizes 2, 3 and 5 are handled by the fixed-size sorter,
+        // everything else is sorted by the fallback sorter: sorting
+        // 5 elements takes 9 comparisons with a sorting network and
+        // 10 with a selection sort
+        using sorter_type = cppsort::small_collection_adapter<
+            cppsort::sorting_network_sorter,
+            cppsort::selection_sorter,
+            std::index_sequence<2, 3, 5>
+        >;
+        cppsort::counting_adapter<sorter_type> sorter;
+
+        std::vector<int> vec;
+        distribution(std::back_inserter(vec), 5);
+        CHECK( sorter(vec) == 9 );
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+
+        vec.clear();
+        distribution(std::back_inserter(vec), 6);
+        CHECK( sorter(vec) == 15 );
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+}
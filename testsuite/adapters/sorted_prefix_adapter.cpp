@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/counting_adapter.h>
+#include <cpp-sort/adapters/sorted_prefix_adapter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/quick_sorter.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+namespace
+{
+    // Sorted prefix followed by a shuffled tail
+    auto sorted_with_tail(int prefix_size, int tail_size)
+        -> std::vector<int>
+    {
+        std::vector<int> res;
+        dist::shuffled{}(std::back_inserter(res), prefix_size + tail_size, 0);
+        std::sort(res.begin(), res.begin() + prefix_size);
+        return res;
+    }
+}
+
+TEST_CASE( "sorted_prefix_adapter tests", "[sorted_prefix_adapter]" )
+{
+    SECTION( "random-access iterators" )
+    {
+        cppsort::sorted_prefix_adapter<cppsort::pdq_sorter> sorter;
+
+        auto vec = sorted_with_tail(5000, 500);
+        sorter(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+
+        vec = sorted_with_tail(5000, 500);
+        sorter(vec, std::greater<>{});
+        CHECK( std::is_sorted(vec.begin(), vec.end(), std::greater<>{}) );
+    }
+
+    SECTION( "bidirectional and forward iterators" )
+    {
+        cppsort::sorted_prefix_adapter<cppsort::quick_sorter> sorter;
+
+        auto vec = sorted_with_tail(1000, 200);
+        std::list<int> li(vec.begin(), vec.end());
+        sorter(li);
+        CHECK( std::is_sorted(li.begin(), li.end()) );
+
+        std::forward_list<int> flist(vec.begin(), vec.end());
+        sorter(flist);
+        CHECK( std::is_sorted(flist.begin(), flist.end()) );
+    }
+
+    SECTION( "already sorted and fully unsorted collections" )
+    {
+        cppsort::sorted_prefix_adapter<cppsort::pdq_sorter> sorter;
+
+        std::vector<int> vec;
+        dist::ascending{}(std::back_inserter(vec), 1000);
+        sorter(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+
+        vec.clear();
+        dist::shuffled{}(std::back_inserter(vec), 1000, 0);
+        sorter(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+
+        vec.clear();
+        sorter(vec);
+        CHECK( vec.empty() );
+    }
+
+    SECTION( "the sorted prefix is not sorted again" )
+    {
+        using sorter = cppsort::counting_adapter<
+            cppsort::sorted_prefix_adapter<cppsort::pdq_sorter>
+        >;
+        using whole_sorter = cppsort::counting_adapter<cppsort::pdq_sorter>;
+
+        auto vec = sorted_with_tail(10000, 100);
+        auto copy = vec;
+        auto count = sorter{}(vec);
+        auto whole_count = whole_sorter{}(copy);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+        CHECK( count < whole_count );
+    }
+
+    SECTION( "stability" )
+    {
+        cppsort::sorted_prefix_adapter<cppsort::merge_sorter> sorter;
+        CHECK( cppsort::is_stable<decltype(sorter)(std::vector<int>&)>::value );
+
+        std::vector<generic_stable_wrapper<int>> vec;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(vec), 2000);
+        for (std::size_t i = 0 ; i < vec.size() ; ++i) {
+            vec[i].order = static_cast<int>(i);
+        }
+        std::stable_sort(vec.begin(), vec.begin() + 1500, [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        });
+        auto copy = vec;
+        std::stable_sort(copy.begin(), copy.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        });
+
+        sorter(vec, &generic_stable_wrapper<int>::value);
+        CHECK( vec == copy );
+    }
+}
@@ -3,7 +3,9 @@
  * SPDX-License-Identifier: MIT
  */
 #include <algorithm>
+#include <cstdint>
 #include <forward_list>
+#include <functional>
 #include <list>
 #include <vector>
 #include <catch2/catch.hpp>
@@ -133,3 +135,65 @@ TEMPLATE_TEST_CASE( "every forward sorter with with stable_adapter", "[stable_ad
         CHECK( std::is_sorted(collection.begin(), collection.end()) );
     }
 }
+
+TEMPLATE_TEST_CASE( "stable_adapter with small and large integer keys", "[stable_adapter]",
+                    cppsort::heap_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::quick_sorter )
+{
+    // Integer keys of at most 32 bits compared with their natural
+    // order are packed with their index, wider keys are not
+
+    cppsort::stable_t<TestType> sorter;
+    auto distribution = dist::shuffled_16_values{};
+
+    SECTION( "16-bit keys, descending order" )
+    {
+        using wrapper16 = generic_stable_wrapper<std::int16_t>;
+        std::vector<wrapper16> collection(412);
+        helpers::iota(collection.begin(), collection.end(), 0, &wrapper16::order);
+        distribution(collection.begin(), collection.size());
+
+        sorter(collection, std::greater<>{}, &wrapper16::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            if (lhs.value != rhs.value) {
+                return lhs.value > rhs.value;
+            }
+            return lhs.order < rhs.order;
+        }) );
+    }
+
+    SECTION( "32-bit keys, ascending order" )
+    {
+        using wrapper32 = generic_stable_wrapper<std::int32_t>;
+        std::vector<wrapper32> collection(412);
+        helpers::iota(collection.begin(), collection.end(), 0, &wrapper32::order);
+        distribution(collection.begin(), collection.size());
+
+        sorter(collection, &wrapper32::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        }) );
+        // Equal keys keep their original order
+        CHECK( std::adjacent_find(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value == rhs.value && lhs.order > rhs.order;
+        }) == collection.end() );
+    }
+
+    SECTION( "64-bit keys" )
+    {
+        using wrapper64 = generic_stable_wrapper<long long int>;
+        std::vector<wrapper64> collection(412);
+        helpers::iota(collection.begin(), collection.end(), 0, &wrapper64::order);
+        distribution(collection.begin(), collection.size());
+
+        sorter(collection, &wrapper64::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value < rhs.value;
+        }) );
+        // Equal keys keep their original order
+        CHECK( std::adjacent_find(collection.begin(), collection.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.value == rhs.value && lhs.order > rhs.order;
+        }) == collection.end() );
+    }
+}
@@ -12,6 +12,7 @@
 #include <testing-tools/distributions.h>
 
 TEMPLATE_TEST_CASE( "test random-access sorters with all_equal distribution", "[distributions]",
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::drop_merge_sorter,
                     cppsort::grail_sorter<>,
@@ -17,6 +17,7 @@ TEMPLATE_TEST_CASE( "test sorter with ascending distribution", "[distributions]"
                     // that could specifically appear with an ascending distribution,
                     // so here is the dedicated test (see issue #103)
                     cppsort::counting_sorter,
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::drop_merge_sorter,
                     cppsort::grail_sorter<>,
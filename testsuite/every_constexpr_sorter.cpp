@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <catch2/catch.hpp>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorters/heap_sorter.h>
+#include <cpp-sort/sorters/insertion_sorter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <testing-tools/algorithm.h>
+
+#if defined(__cpp_lib_constexpr_algorithms) && \
+    defined(__cpp_lib_is_constant_evaluated) && \
+    defined(__cpp_constexpr_dynamic_alloc)
+
+namespace
+{
+    struct wrapper
+    {
+        int value;
+    };
+
+    // Fill the collection with values in [0, 53) in a scrambled
+    // order with many duplicates
+    template<std::size_t N>
+    constexpr auto scrambled_array()
+        -> std::array<int, N>
+    {
+        std::array<int, N> res = {};
+        for (std::size_t i = 0 ; i < N ; ++i) {
+            res[i] = static_cast<int>((i * 37 + 11) % 53);
+        }
+        return res;
+    }
+
+    template<typename Sorter, std::size_t N>
+    constexpr auto test_sorter()
+        -> bool
+    {
+        Sorter sorter;
+
+        auto collection = scrambled_array<N>();
+        sorter(collection);
+        bool res = helpers::is_sorted(collection.begin(), collection.end());
+
+        collection = scrambled_array<N>();
+        sorter(collection.begin(), collection.end(), std::greater<>{});
+        res = res && helpers::is_sorted(collection.begin(), collection.end(), std::greater<>{});
+
+        std::array<wrapper, N> wrappers = {};
+        for (std::size_t i = 0 ; i < N ; ++i) {
+            wrappers[i].value = collection[N - i - 1];
+        }
+        sorter(wrappers, std::greater<>{}, &wrapper::value);
+        res = res && helpers::is_sorted(wrappers.begin(), wrappers.end(),
+                                        std::greater<>{}, &wrapper::value);
+
+        return res;
+    }
+}
+
+TEMPLATE_TEST_CASE( "sorters usable in constant expressions", "[sorters][constexpr]",
+                    cppsort::heap_sorter,
+                    cppsort::insertion_sorter,
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter )
+{
+    // Sizes below and above the thresholds of the hybrid algorithms
+    constexpr bool small_is_sorted = test_sorter<TestType, 20>();
+    CHECK( small_is_sorted );
+    constexpr bool big_is_sorted = test_sorter<TestType, 300>();
+    CHECK( big_is_sorted );
+}
+
+TEST_CASE( "sorting_network_sorter usable in constant expressions",
+           "[sorting_network_sorter][constexpr]" )
+{
+    constexpr bool is_sorted_3 = test_sorter<cppsort::sorting_network_sorter<3>, 3>();
+    CHECK( is_sorted_3 );
+    constexpr bool is_sorted_17 = test_sorter<cppsort::sorting_network_sorter<17>, 17>();
+    CHECK( is_sorted_17 );
+    constexpr bool is_sorted_32 = test_sorter<cppsort::sorting_network_sorter<32>, 32>();
+    CHECK( is_sorted_32 );
+    constexpr bool is_sorted_50 = test_sorter<cppsort::sorting_network_sorter<50>, 50>();
+    CHECK( is_sorted_50 );
+}
+
+#endif
@@ -112,6 +112,12 @@ TEST_CASE( "test every instantiated sorter", "[sorters]" )
         CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
     }
 
+    SECTION( "rank_counting_sorter" )
+    {
+        cppsort::rank_counting_sort(collection);
+        CHECK( std::is_sorted(std::begin(collection), std::end(collection)) );
+    }
+
     SECTION( "selection_sorter" )
     {
         cppsort::selection_sort(collection);
@@ -15,6 +15,7 @@
 #include <testing-tools/distributions.h>
 
 TEMPLATE_TEST_CASE( "test every random-access sorter", "[sorters]",
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::counting_sorter,
                     cppsort::drop_merge_sorter,
@@ -31,6 +32,7 @@ TEMPLATE_TEST_CASE( "test every random-access sorter", "[sorters]",
                     cppsort::poplar_sorter,
                     cppsort::quick_merge_sorter,
                     cppsort::quick_sorter,
+                    cppsort::rank_counting_sorter,
                     cppsort::selection_sorter,
                     cppsort::ska_sorter,
                     cppsort::slab_sorter,
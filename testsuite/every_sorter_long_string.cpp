@@ -38,6 +38,7 @@ namespace
 }
 
 TEMPLATE_TEST_CASE( "test every sorter with long std::string", "[sorters]",
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::default_sorter,
                     cppsort::drop_merge_sorter,
@@ -14,6 +14,7 @@
 #include <testing-tools/random.h>
 
 TEMPLATE_TEST_CASE( "test most sorters with no_post_iterator", "[sorters]",
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::counting_sorter,
                     cppsort::default_sorter,
@@ -28,6 +29,7 @@ TEMPLATE_TEST_CASE( "test most sorters with no_post_iterator", "[sorters]",
                     cppsort::poplar_sorter,
                     cppsort::quick_merge_sorter,
                     cppsort::quick_sorter,
+                    cppsort::rank_counting_sorter,
                     cppsort::selection_sorter,
                     cppsort::ska_sorter,
                     cppsort::slab_sorter,
@@ -7,6 +7,7 @@
 #include <cpp-sort/sorters.h>
 
 TEMPLATE_TEST_CASE( "test every sorter with small collections", "[sorters]",
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::counting_sorter,
                     cppsort::drop_merge_sorter,
@@ -20,6 +21,7 @@ TEMPLATE_TEST_CASE( "test every sorter with small collections", "[sorters]",
                     cppsort::poplar_sorter,
                     cppsort::quick_merge_sorter,
                     cppsort::quick_sorter,
+                    cppsort::rank_counting_sorter,
                     cppsort::selection_sorter,
                     cppsort::ska_sorter,
                     cppsort::slab_sorter,
@@ -13,6 +13,7 @@
 #include <testing-tools/test_vector.h>
 
 TEMPLATE_TEST_CASE( "test every sorter with an int8_t difference_type", "[sorters]",
+                    cppsort::auto_sorter,
                     cppsort::cartesian_tree_sorter,
                     cppsort::counting_sorter,
                     cppsort::drop_merge_sorter,
@@ -29,6 +30,7 @@ TEMPLATE_TEST_CASE( "test every sorter with an int8_t difference_type", "[sorter
                     cppsort::poplar_sorter,
                     cppsort::quick_merge_sorter,
                     cppsort::quick_sorter,
+                    cppsort::rank_counting_sorter,
                     cppsort::selection_sorter,
                     cppsort::ska_sorter,
                     cppsort::slab_sorter,
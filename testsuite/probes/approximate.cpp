@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <cstddef>
+#include <functional>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/probes/approximate.h>
+#include <cpp-sort/probes/inv.h>
+#include <cpp-sort/probes/runs.h>
+#include <cpp-sort/utility/functional.h>
+
+namespace
+{
+    // Deterministic permutation of [0, size) for a prime size
+    auto scattered_values(int size)
+        -> std::vector<int>
+    {
+        std::vector<int> res;
+        for (int i = 0 ; i < size ; ++i) {
+            res.push_back(static_cast<int>((i * 7919LL) % size));
+        }
+        return res;
+    }
+
+    template<typename Estimate, typename Integer>
+    auto contains(const Estimate& estimate, Integer value)
+        -> bool
+    {
+        return estimate.lower_bound <= value
+            && value <= estimate.upper_bound
+            && estimate.lower_bound <= estimate.value
+            && estimate.value <= estimate.upper_bound;
+    }
+}
+
+TEST_CASE( "approximate presortedness measures", "[probe][approximate]" )
+{
+    namespace approx = cppsort::probe::approximate;
+
+    SECTION( "exact results for small collections" )
+    {
+        std::vector<int> vec = { 4, 2, 6, 5, 3, 1, 9, 7, 10, 8 };
+
+        auto runs = approx::runs(vec);
+        CHECK( runs.value == cppsort::probe::runs(vec) );
+        CHECK( runs.lower_bound == runs.value );
+        CHECK( runs.upper_bound == runs.value );
+
+        auto inv = approx::inv(vec.begin(), vec.end());
+        CHECK( inv.value == cppsort::probe::inv(vec) );
+        CHECK( inv.lower_bound == inv.value );
+        CHECK( inv.upper_bound == inv.value );
+    }
+
+    SECTION( "sorted and reverse-sorted collections" )
+    {
+        std::vector<int> vec;
+        for (int i = 0 ; i < 10000 ; ++i) {
+            vec.push_back(i);
+        }
+
+        auto runs = approx::runs(vec);
+        CHECK( runs.value == 0 );
+        CHECK( runs.lower_bound == 0 );
+        CHECK( runs.upper_bound < approx::runs.max_for_size(10000) / 50 );
+
+        auto inv = approx::inv(vec);
+        CHECK( inv.value == 0 );
+        CHECK( inv.lower_bound == 0 );
+        CHECK( inv.upper_bound < approx::inv.max_for_size(10000) / 50 );
+
+        auto desc_runs = approx::runs(vec, std::greater<>{});
+        CHECK( desc_runs.value == approx::runs.max_for_size(10000) );
+        CHECK( desc_runs.upper_bound == desc_runs.value );
+
+        auto desc_inv = approx::inv(vec, std::greater<>{});
+        CHECK( desc_inv.value == approx::inv.max_for_size(10000) );
+        CHECK( desc_inv.upper_bound == desc_inv.value );
+    }
+
+    SECTION( "confidence intervals contain the exact measures" )
+    {
+        auto vec = scattered_values(10007);
+        CHECK( contains(approx::runs(vec), cppsort::probe::runs(vec)) );
+        CHECK( contains(approx::inv(vec), cppsort::probe::inv(vec)) );
+
+        // Sawtooth pattern made of runs of 100 elements
+        std::vector<int> sawtooth;
+        for (int i = 0 ; i < 10000 ; ++i) {
+            sawtooth.push_back(i % 100);
+        }
+        CHECK( contains(approx::runs(sawtooth), cppsort::probe::runs(sawtooth)) );
+        CHECK( contains(approx::inv(sawtooth), cppsort::probe::inv(sawtooth)) );
+    }
+
+    SECTION( "bigger samples make for tighter intervals" )
+    {
+        auto vec = scattered_values(10007);
+        constexpr auto precise_inv = approx::inv_probe<8192>{};
+
+        auto estimate = approx::inv(vec);
+        auto precise = precise_inv(vec);
+        CHECK( contains(precise, cppsort::probe::inv(vec)) );
+        CHECK( precise.upper_bound - precise.lower_bound < estimate.upper_bound - estimate.lower_bound );
+    }
+
+    SECTION( "projection" )
+    {
+        struct wrapper { int value; };
+        std::vector<wrapper> vec;
+        for (int value: scattered_values(1009)) {
+            vec.push_back({ value });
+        }
+
+        auto estimate = approx::inv(vec, &wrapper::value);
+        std::vector<int> values = scattered_values(1009);
+        CHECK( estimate.value == approx::inv(values).value );
+    }
+}
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <forward_list>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/probes/combined.h>
+#include <cpp-sort/probes/dis.h>
+#include <cpp-sort/probes/inv.h>
+#include <cpp-sort/probes/max.h>
+#include <cpp-sort/probes/rem.h>
+#include <cpp-sort/probes/runs.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+namespace
+{
+    template<typename Collection, typename... Args>
+    auto check_combined_probe(Collection& collection, Args... args)
+        -> void
+    {
+        using namespace cppsort;
+
+        auto res = probe::combined(collection, args...);
+        CHECK( res.dis == probe::dis(collection, args...) );
+        CHECK( res.inv == probe::inv(collection, args...) );
+        CHECK( res.max == probe::max(collection, args...) );
+        CHECK( res.rem == probe::rem(collection, args...) );
+        CHECK( res.runs == probe::runs(collection, args...) );
+
+        auto res_it = probe::combined(collection.begin(), collection.end(), args...);
+        CHECK( res_it.dis == res.dis );
+        CHECK( res_it.inv == res.inv );
+        CHECK( res_it.max == res.max );
+        CHECK( res_it.rem == res.rem );
+        CHECK( res_it.runs == res.runs );
+    }
+}
+
+TEST_CASE( "combined presortedness measures", "[probe][combined]" )
+{
+    SECTION( "simple test" )
+    {
+        std::vector<int> vec = { 4, 2, 6, 5, 3, 1, 9, 7, 10, 8 };
+        check_combined_probe(vec);
+        check_combined_probe(vec, std::greater<>{});
+    }
+
+    SECTION( "empty and one-element collections" )
+    {
+        std::vector<int> vec;
+        auto res = cppsort::probe::combined(vec);
+        CHECK( res.dis == 0 );
+        CHECK( res.inv == 0 );
+        CHECK( res.max == 0 );
+        CHECK( res.rem == 0 );
+        CHECK( res.runs == 0 );
+
+        vec.push_back(42);
+        check_combined_probe(vec);
+    }
+
+    SECTION( "random-access, bidirectional and forward iterators" )
+    {
+        std::vector<int> vec;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(vec), 500);
+
+        check_combined_probe(vec);
+        std::list<int> li(vec.begin(), vec.end());
+        check_combined_probe(li);
+        std::forward_list<int> flist(vec.begin(), vec.end());
+        check_combined_probe(flist);
+    }
+
+    SECTION( "patterns" )
+    {
+        std::vector<int> vec;
+        dist::ascending_sawtooth{}(std::back_inserter(vec), 300);
+        check_combined_probe(vec);
+
+        vec.clear();
+        dist::descending{}(std::back_inserter(vec), 300);
+        check_combined_probe(vec);
+
+        vec.clear();
+        dist::shuffled{}(std::back_inserter(vec), 300, 0);
+        check_combined_probe(vec);
+    }
+
+    SECTION( "projection" )
+    {
+        std::vector<generic_wrapper<int>> vec;
+        dist::shuffled{}(std::back_inserter(vec), 300, 0);
+        check_combined_probe(vec, std::less<>{}, &generic_wrapper<int>::value);
+    }
+
+    SECTION( "subset of measures" )
+    {
+        using namespace cppsort::probe;
+
+        std::vector<int> vec;
+        dist::shuffled{}(std::back_inserter(vec), 300, 0);
+
+        auto inv_max = combined_probe<measure::inv | measure::max>{}(vec);
+        CHECK( inv_max.inv == inv(vec) );
+        CHECK( inv_max.max == max(vec) );
+        CHECK( inv_max.dis == -1 );
+        CHECK( inv_max.rem == -1 );
+        CHECK( inv_max.runs == -1 );
+
+        auto max_runs = combined_probe<measure::max | measure::runs>{}(vec);
+        CHECK( max_runs.max == max(vec) );
+        CHECK( max_runs.runs == runs(vec) );
+        CHECK( max_runs.inv == -1 );
+
+        auto rem_only = combined_probe<measure::rem>{}(vec);
+        CHECK( rem_only.rem == rem(vec) );
+        CHECK( rem_only.dis == -1 );
+    }
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/auto_sorter.h>
+#include <testing-tools/algorithm.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/wrapper.h>
+
+TEST_CASE( "auto_sorter over various distributions", "[auto_sorter]" )
+{
+    // Every distribution is meant to exercise a different
+    // sorter picked by auto_sorter
+    std::vector<int> collection;
+    collection.reserve(5000);
+
+    SECTION( "ascending sawtooth" )
+    {
+        dist::ascending_sawtooth{}(std::back_inserter(collection), 5000);
+        cppsort::auto_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "descending" )
+    {
+        dist::descending{}(std::back_inserter(collection), 5000);
+        cppsort::auto_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "few elements out of place" )
+    {
+        dist::ascending{}(std::back_inserter(collection), 5000);
+        for (int i = 0 ; i < 5000 ; i += 97) {
+            std::swap(collection[i], collection[4999 - i]);
+        }
+        cppsort::auto_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "dense range of values" )
+    {
+        dist::shuffled{}(std::back_inserter(collection), 5000, -2500);
+        cppsort::auto_sort(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+
+    SECTION( "sparse range of values" )
+    {
+        dist::shuffled{}(std::back_inserter(collection), 5000);
+        for (auto& value: collection) {
+            value *= 1000;
+        }
+        cppsort::auto_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "few distinct values" )
+    {
+        dist::shuffled_16_values{}(std::back_inserter(collection), 5000);
+        cppsort::auto_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
+
+TEST_CASE( "auto_sorter with projections", "[auto_sorter][projection]" )
+{
+    std::vector<generic_wrapper<double>> collection;
+    dist::shuffled{}.call<double>(std::back_inserter(collection), 5000, -1250);
+
+    SECTION( "radix-sortable projection" )
+    {
+        cppsort::auto_sort(collection, &generic_wrapper<double>::value);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::less<>{}, &generic_wrapper<double>::value) );
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        cppsort::auto_sort(collection, std::greater<>{}, &generic_wrapper<double>::value);
+        CHECK( helpers::is_sorted(collection.begin(), collection.end(),
+                                  std::greater<>{}, &generic_wrapper<double>::value) );
+    }
+}
+
+TEST_CASE( "auto_sorter picks an algorithm suited to the presortedness",
+           "[auto_sorter]" )
+{
+    using cppsort::detail::auto_sort_algorithm;
+
+    std::less<> compare;
+    cppsort::utility::identity projection;
+    auto pick = [&](std::vector<int>& collection) {
+        return cppsort::detail::pick_auto_sort_algorithm(collection.begin(), collection.end(),
+                                                         compare, projection);
+    };
+
+    std::vector<int> collection;
+    collection.reserve(5000);
+
+    SECTION( "small collection" )
+    {
+        dist::shuffled{}(std::back_inserter(collection), 1000);
+        CHECK( pick(collection) == auto_sort_algorithm::pdq_sort );
+    }
+
+    SECTION( "sorted" )
+    {
+        dist::ascending{}(std::back_inserter(collection), 5000);
+        CHECK( pick(collection) == auto_sort_algorithm::verge_sort );
+    }
+
+    SECTION( "reversed" )
+    {
+        dist::descending{}(std::back_inserter(collection), 5000);
+        CHECK( pick(collection) == auto_sort_algorithm::verge_sort );
+    }
+
+    SECTION( "nearly sorted" )
+    {
+        dist::ascending{}(std::back_inserter(collection), 5000);
+        for (int i = 0 ; i < 5000 ; i += 97) {
+            std::swap(collection[i], collection[4999 - i]);
+        }
+        CHECK( pick(collection) == auto_sort_algorithm::drop_merge_sort );
+    }
+
+    SECTION( "random with a dense range of values" )
+    {
+        dist::shuffled{}(std::back_inserter(collection), 5000);
+        CHECK( pick(collection) == auto_sort_algorithm::counting_sort );
+    }
+
+    SECTION( "random with a sparse range of values" )
+    {
+        dist::shuffled{}(std::back_inserter(collection), 5000);
+        for (auto& value: collection) {
+            value *= 1000;
+        }
+        CHECK( pick(collection) == auto_sort_algorithm::ska_sort );
+    }
+
+    SECTION( "random with few distinct values" )
+    {
+        // Four distinct values, too sparse for counting sort
+        dist::shuffled{}(std::back_inserter(collection), 5000);
+        for (auto& value: collection) {
+            value = value % 4 * 100000;
+        }
+        CHECK( pick(collection) == auto_sort_algorithm::pdq_sort );
+    }
+}
+
+TEST_CASE( "auto_sorter only picks radix and counting sorts when they apply",
+           "[auto_sorter]" )
+{
+    using cppsort::detail::auto_sort_algorithm;
+
+    std::vector<int> collection;
+    dist::shuffled{}(std::back_inserter(collection), 5000);
+    for (auto& value: collection) {
+        value *= 1000;
+    }
+
+    SECTION( "comparison not handled by radix sort" )
+    {
+        std::greater<> compare;
+        cppsort::utility::identity projection;
+        CHECK( cppsort::detail::pick_auto_sort_algorithm(collection.begin(), collection.end(),
+                                                         compare, projection)
+               == auto_sort_algorithm::pdq_sort );
+    }
+
+    SECTION( "comparison not handled by counting sort" )
+    {
+        auto compare = [](int lhs, int rhs) { return lhs < rhs; };
+        cppsort::utility::identity projection;
+        dist::shuffled{}(collection.begin(), 5000);
+        CHECK( cppsort::detail::pick_auto_sort_algorithm(collection.begin(), collection.end(),
+                                                         compare, projection)
+               == auto_sort_algorithm::pdq_sort );
+    }
+}
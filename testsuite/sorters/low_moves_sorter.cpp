@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <numeric>
+#include <catch2/catch.hpp>
+#include <cpp-sort/fixed/low_moves_sorter.h>
+#include <testing-tools/random.h>
+
+namespace
+{
+    // Counts the number of times instances are moved
+    struct move_counter
+    {
+        static int moves;
+
+        int value = 0;
+
+        move_counter() = default;
+        move_counter(const move_counter&) = delete;
+        auto operator=(const move_counter&) -> move_counter& = delete;
+
+        explicit move_counter(int value):
+            value(value)
+        {}
+
+        move_counter(move_counter&& other):
+            value(other.value)
+        {
+            ++moves;
+        }
+
+        auto operator=(move_counter&& other)
+            -> move_counter&
+        {
+            value = other.value;
+            ++moves;
+            return *this;
+        }
+    };
+
+    int move_counter::moves = 0;
+
+    // Lowest number of moves needed to sort a permutation of
+    // [0, N) with a single temporary element: every element that
+    // isn't at its final position is moved once, plus one move
+    // per cycle of at least two elements
+    template<std::size_t N>
+    auto optimal_moves(const std::array<int, N>& values)
+        -> int
+    {
+        std::array<bool, N> visited = {};
+        int res = 0;
+        for (std::size_t i = 0 ; i < N ; ++i) {
+            if (visited[i] || values[i] == static_cast<int>(i)) continue;
+            ++res;
+            for (auto j = i ; not visited[j] ; j = static_cast<std::size_t>(values[j])) {
+                visited[j] = true;
+                ++res;
+            }
+        }
+        return res;
+    }
+
+    template<std::size_t N>
+    auto check_low_moves_sorter()
+        -> void
+    {
+        for (int i = 0 ; i < 10 ; ++i) {
+            std::array<int, N> values;
+            std::iota(values.begin(), values.end(), 0);
+            std::shuffle(values.begin(), values.end(), hasard::engine());
+
+            std::array<move_counter, N> collection;
+            for (std::size_t j = 0 ; j < N ; ++j) {
+                collection[j].value = values[j];
+            }
+
+            move_counter::moves = 0;
+            cppsort::low_moves_sorter<N>{}(collection, &move_counter::value);
+            CHECK( std::is_sorted(collection.begin(), collection.end(),
+                                  [](const auto& lhs, const auto& rhs) {
+                                      return lhs.value < rhs.value;
+                                  }) );
+            CHECK( move_counter::moves == optimal_moves(values) );
+        }
+    }
+}
+
+TEST_CASE( "low_moves_sorter performs the lowest number of moves", "[low_moves_sorter]" )
+{
+    check_low_moves_sorter<4>();
+    check_low_moves_sorter<5>();
+    check_low_moves_sorter<6>();
+    check_low_moves_sorter<7>();
+    check_low_moves_sorter<8>();
+    check_low_moves_sorter<9>();
+    check_low_moves_sorter<10>();
+    check_low_moves_sorter<11>();
+    check_low_moves_sorter<12>();
+    check_low_moves_sorter<13>();
+    check_low_moves_sorter<14>();
+    check_low_moves_sorter<15>();
+    check_low_moves_sorter<16>();
+}
+
+TEST_CASE( "low_moves_sorter with duplicates and bigger sizes", "[low_moves_sorter]" )
+{
+    SECTION( "duplicates" )
+    {
+        std::array<int, 16> collection;
+        for (std::size_t i = 0 ; i < collection.size() ; ++i) {
+            collection[i] = static_cast<int>(i % 3);
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::low_moves_sorter<16>{}(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "sizes above 16" )
+    {
+        std::array<int, 25> collection;
+        std::iota(collection.begin(), collection.end(), -12);
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        cppsort::low_moves_sorter<25>{}(collection, std::greater<>{});
+        CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+    }
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/fixed/sorting_network_sorter.h>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/quick_sorter.h>
+#include <testing-tools/random.h>
+
+TEMPLATE_TEST_CASE( "sorting networks as a base case", "[sorters][sorting_network_sorter]",
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::quick_sorter )
+{
+    // Small collections of arithmetic types sorted without projection
+    // are sorted with sorting networks, test every size around the
+    // thresholds with both the default and the reverse order
+
+    TestType sorter;
+
+    SECTION( "every size with std::less<>" )
+    {
+        for (int size = 0 ; size < 80 ; ++size) {
+            std::vector<int> collection(size);
+            std::iota(collection.begin(), collection.end(), -size / 2);
+            std::shuffle(collection.begin(), collection.end(), hasard::engine());
+            sorter(collection);
+            CHECK( std::is_sorted(collection.begin(), collection.end()) );
+        }
+    }
+
+    SECTION( "every size with std::greater<>" )
+    {
+        for (int size = 0 ; size < 80 ; ++size) {
+            std::vector<long long> collection(size);
+            std::iota(collection.begin(), collection.end(), 0);
+            std::shuffle(collection.begin(), collection.end(), hasard::engine());
+            sorter(collection, std::greater<>{});
+            CHECK( std::is_sorted(collection.begin(), collection.end(), std::greater<>{}) );
+        }
+    }
+
+    SECTION( "extreme values of small types" )
+    {
+        std::vector<std::int8_t> collection;
+        for (int i = 0 ; i < 5 ; ++i) {
+            collection.push_back(std::numeric_limits<std::int8_t>::min());
+            collection.push_back(std::numeric_limits<std::int8_t>::max());
+            collection.push_back(-1);
+            collection.push_back(0);
+            collection.push_back(1);
+        }
+        std::shuffle(collection.begin(), collection.end(), hasard::engine());
+        sorter(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+        std::vector<std::uint64_t> collection2;
+        for (int i = 0 ; i < 6 ; ++i) {
+            collection2.push_back(std::numeric_limits<std::uint64_t>::max());
+            collection2.push_back(std::numeric_limits<std::uint64_t>::max() - 1);
+            collection2.push_back(0);
+            collection2.push_back(1);
+            collection2.push_back(std::uint64_t(1) << 63);
+        }
+        std::shuffle(collection2.begin(), collection2.end(), hasard::engine());
+        sorter(collection2, std::greater<>{});
+        CHECK( std::is_sorted(collection2.begin(), collection2.end(), std::greater<>{}) );
+    }
+}
+
+TEMPLATE_TEST_CASE( "base case with proxy iterators", "[sorters][sorting_network_sorter]",
+                    cppsort::merge_sorter,
+                    cppsort::pdq_sorter,
+                    cppsort::quick_sorter )
+{
+    // The iterators of std::vector<bool> return proxies, which
+    // can't go through the swap_if optimizations: make sure that
+    // small collections of bool still compile and are handled
+    // by the regular base case
+
+    TestType sorter;
+
+    std::vector<bool> collection = { false, false, true, true };
+    sorter(collection);
+    CHECK( collection == std::vector<bool>{ false, false, true, true } );
+}
+
+TEST_CASE( "sorting_network_sorter with proxy iterators", "[sorting_network_sorter]" )
+{
+    cppsort::sorting_network_sorter<4> sorter;
+
+    std::vector<bool> collection = { true, false, true, false };
+    sorter(collection);
+    CHECK( collection == std::vector<bool>{ false, false, true, true } );
+}
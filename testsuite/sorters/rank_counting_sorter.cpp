@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/rank_counting_sorter.h>
+#include <testing-tools/distributions.h>
+#include <testing-tools/random.h>
+
+namespace
+{
+    // Collection of the given size containing the given number
+    // of distinct values spread over the whole range of T
+    template<typename T>
+    auto few_wide_values(std::size_t size, std::size_t distinct)
+        -> std::vector<T>
+    {
+        std::vector<T> keys;
+        for (std::size_t i = 0 ; i < distinct ; ++i) {
+            keys.push_back(static_cast<T>(hasard::engine()()));
+        }
+
+        std::vector<T> res;
+        res.reserve(size);
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            res.push_back(keys[i % distinct]);
+        }
+        std::shuffle(res.begin(), res.end(), hasard::engine());
+        return res;
+    }
+}
+
+TEST_CASE( "rank_counting_sorter tests", "[rank_counting_sorter]" )
+{
+    SECTION( "sort with few distinct wide values" )
+    {
+        auto vec = few_wide_values<std::int64_t>(100'000, 3'000);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::rank_counting_sort(vec);
+        CHECK( vec == expected );
+    }
+
+    SECTION( "reverse sort with few distinct wide values" )
+    {
+        auto vec = few_wide_values<std::uint64_t>(100'000, 3'000);
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+        cppsort::rank_counting_sort(vec.begin(), vec.end(), std::greater<>{});
+        CHECK( vec == expected );
+    }
+
+    SECTION( "sort with many distinct values" )
+    {
+        std::vector<int> vec;
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(vec), 100'000, -1568);
+
+        cppsort::rank_counting_sort(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "sort with a frequent value and many distinct values" )
+    {
+        // The sample contains enough repeated values to try to
+        // count the values, but the dictionary gets too big
+        std::vector<int> vec;
+        auto distribution = dist::shuffled{};
+        distribution(std::back_inserter(vec), 100'000, 1);
+        std::fill_n(vec.begin(), 50'000, 0);
+        std::shuffle(vec.begin(), vec.end(), hasard::engine());
+
+        cppsort::rank_counting_sort(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+        CHECK( std::count(vec.begin(), vec.end(), 0) == 50'000 );
+    }
+
+    SECTION( "sort small collection" )
+    {
+        auto vec = few_wide_values<short>(500, 10);
+        cppsort::rank_counting_sort(vec);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+#ifdef __SIZEOF_INT128__
+    SECTION( "sort with few distinct int128 values" )
+    {
+        auto vec = few_wide_values<__int128_t>(100'000, 3'000);
+        for (auto& value: vec) {
+            value <<= 60;
+        }
+        auto expected = vec;
+        std::sort(expected.begin(), expected.end());
+
+        cppsort::rank_counting_sort(vec);
+        CHECK( vec == expected );
+    }
+#endif
+}
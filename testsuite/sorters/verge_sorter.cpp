@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/adapters/stable_adapter.h>
+#include <cpp-sort/sorters/verge_sorter.h>
+#include <testing-tools/random.h>
+#include <testing-tools/wrapper.h>
+
+namespace
+{
+    // Concatenation of sorted shards of various sizes, every
+    // other shard being sorted in descending order
+    template<typename Collection>
+    auto make_shards(Collection& collection, int nb_shards)
+        -> void
+    {
+        for (int shard = 0 ; shard < nb_shards ; ++shard) {
+            std::vector<int> values;
+            auto size = hasard::randint(150, 1500, hasard::bit_gen());
+            for (int i = 0 ; i < size ; ++i) {
+                values.push_back(hasard::randint(0, 5000, hasard::bit_gen()));
+            }
+            if (shard % 2) {
+                std::sort(values.begin(), values.end(), std::greater<>{});
+            } else {
+                std::sort(values.begin(), values.end());
+            }
+            collection.insert(collection.end(), values.begin(), values.end());
+        }
+    }
+}
+
+TEST_CASE( "verge_sorter over many long runs", "[verge_sorter]" )
+{
+    SECTION( "random-access collection" )
+    {
+        std::vector<int> collection;
+        make_shards(collection, 150);
+        cppsort::verge_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "bidirectional collection" )
+    {
+        std::list<int> collection;
+        make_shards(collection, 150);
+        cppsort::verge_sort(collection);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
+
+TEST_CASE( "stable verge_sorter over many long runs", "[verge_sorter][stable_adapter]" )
+{
+    using wrapper = generic_stable_wrapper<int>;
+
+    std::vector<int> values;
+    make_shards(values, 100);
+
+    auto to_wrappers = [&](auto& collection) {
+        int order = 0;
+        for (int value: values) {
+            wrapper elem(value);
+            elem.order = order++;
+            collection.push_back(elem);
+        }
+    };
+
+    cppsort::stable_t<cppsort::verge_sorter> sorter;
+
+    SECTION( "random-access collection" )
+    {
+        std::vector<wrapper> collection;
+        to_wrappers(collection);
+        sorter(collection, &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+
+    SECTION( "bidirectional collection" )
+    {
+        std::list<wrapper> collection;
+        to_wrappers(collection);
+        sorter(collection, &wrapper::value);
+        CHECK( std::is_sorted(collection.begin(), collection.end()) );
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/apply_permutation.h>
+#include <cpp-sort/utility/argsort.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    // Big enough to be handled with the cycles rather than
+    // with the buffered algorithm
+    struct big_element
+    {
+        int value;
+        std::array<char, 124> padding;
+    };
+
+    auto random_permutation(std::size_t size)
+        -> std::vector<std::size_t>
+    {
+        std::vector<std::size_t> indices(size);
+        std::iota(indices.begin(), indices.end(), std::size_t(0));
+        std::shuffle(indices.begin(), indices.end(), std::mt19937(static_cast<unsigned>(size)));
+        return indices;
+    }
+
+    template<typename T, typename Projection>
+    auto check_permutations(const std::vector<T>& original, Projection projection)
+        -> void
+    {
+        auto indices = random_permutation(original.size());
+
+        std::vector<T> permuted = original;
+        cppsort::utility::apply_permutation(permuted.begin(), permuted.end(), indices.begin());
+        for (std::size_t i = 0 ; i < original.size() ; ++i) {
+            CHECK( projection(permuted[i]) == projection(original[indices[i]]) );
+        }
+
+        // The inverse permutation gives back the original collection
+        cppsort::utility::apply_inverse_permutation(permuted.begin(), permuted.end(), indices.begin());
+        for (std::size_t i = 0 ; i < original.size() ; ++i) {
+            CHECK( projection(permuted[i]) == projection(original[i]) );
+        }
+    }
+}
+
+TEST_CASE( "apply_permutation and apply_inverse_permutation",
+           "[utility][apply_permutation]" )
+{
+    auto size = GENERATE(as<std::size_t>{}, 0, 1, 10, 31, 32, 1000, 100000);
+
+    SECTION( "small elements" )
+    {
+        std::vector<int> collection;
+        collection.reserve(size);
+        auto distribution = dist::shuffled{};
+        if (size >= 5) {
+            distribution(std::back_inserter(collection), size, -1568);
+        } else {
+            for (std::size_t i = 0 ; i < size ; ++i) {
+                collection.push_back(static_cast<int>(i));
+            }
+        }
+        check_permutations(collection, [](int value) { return value; });
+    }
+
+    SECTION( "big elements" )
+    {
+        std::vector<big_element> collection(size);
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            collection[i].value = static_cast<int>(i);
+        }
+        check_permutations(collection, [](const big_element& elem) { return elem.value; });
+    }
+
+    SECTION( "non-trivial elements" )
+    {
+        std::vector<std::string> collection;
+        collection.reserve(size);
+        for (std::size_t i = 0 ; i < size ; ++i) {
+            collection.push_back(std::to_string(i) + " is a long enough string to allocate");
+        }
+        check_permutations(collection, [](const std::string& str) { return str; });
+    }
+}
+
+TEST_CASE( "apply_permutation with the result of argsort",
+           "[utility][apply_permutation][argsort]" )
+{
+    std::vector<std::uint32_t> collection;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(collection), 10000);
+    std::vector<std::uint32_t> other = collection;
+
+    auto indices = cppsort::utility::argsort(collection);
+    cppsort::utility::apply_permutation(collection, indices);
+    CHECK( std::is_sorted(collection.begin(), collection.end()) );
+
+    // Moving the sorted elements back to their original positions
+    cppsort::utility::apply_inverse_permutation(collection, indices);
+    CHECK( collection == other );
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/utility/argsort.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    template<typename Index, typename T, typename Compare=std::less<>>
+    auto is_sorting_permutation(const std::vector<Index>& indices, const std::vector<T>& collection,
+                                Compare compare={})
+        -> bool
+    {
+        if (indices.size() != collection.size()) {
+            return false;
+        }
+        std::vector<bool> seen(collection.size(), false);
+        for (auto idx: indices) {
+            if (idx >= collection.size() || seen[idx]) {
+                return false;
+            }
+            seen[idx] = true;
+        }
+        return std::is_sorted(indices.begin(), indices.end(), [&](Index lhs, Index rhs) {
+            return compare(collection[lhs], collection[rhs]);
+        });
+    }
+
+    // Whether equivalent elements appear in the order of their indices
+    template<typename Index, typename T>
+    auto is_stable_permutation(const std::vector<Index>& indices, const std::vector<T>& collection)
+        -> bool
+    {
+        for (std::size_t i = 1 ; i < indices.size() ; ++i) {
+            if (collection[indices[i - 1]] == collection[indices[i]] && indices[i - 1] > indices[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE( "argsort with the default strategies", "[utility][argsort]" )
+{
+    using namespace cppsort;
+
+    SECTION( "small integer keys" )
+    {
+        std::vector<int> collection;
+        auto distribution = dist::shuffled_16_values{};
+        distribution(std::back_inserter(collection), 10000);
+        auto copy = collection;
+
+        auto indices = utility::argsort(collection);
+        CHECK( is_sorting_permutation(indices, collection) );
+        CHECK( is_stable_permutation(indices, collection) );
+        CHECK( collection == copy );
+
+        auto indices32 = utility::argsort<std::uint32_t>(collection, std::greater<>{});
+        CHECK( is_sorting_permutation(indices32, collection, std::greater<>{}) );
+        CHECK( is_stable_permutation(indices32, collection) );
+    }
+
+    SECTION( "radix-sortable keys" )
+    {
+        std::vector<double> collection;
+        auto distribution = dist::shuffled{};
+        distribution.call<double>(std::back_inserter(collection), 10000, -5000);
+
+        auto indices = utility::argsort<std::uint32_t>(collection);
+        CHECK( is_sorting_permutation(indices, collection) );
+    }
+
+    SECTION( "comparison fallback" )
+    {
+        std::vector<std::string> collection = { "foo", "bar", "baz", "qux", "", "foo" };
+        auto indices = utility::argsort(collection, std::greater<>{});
+        CHECK( is_sorting_permutation(indices, collection, std::greater<>{}) );
+
+        auto by_size = utility::argsort(collection, std::less<>{}, &std::string::size);
+        CHECK( by_size.front() == 4 );
+    }
+
+    SECTION( "empty collection" )
+    {
+        std::vector<int> collection;
+        CHECK( utility::argsort(collection).empty() );
+    }
+}
+
+TEST_CASE( "argsort with a sorter", "[utility][argsort]" )
+{
+    using namespace cppsort;
+
+    std::vector<long long int> collection;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(collection), 5000);
+
+    SECTION( "stable sorter" )
+    {
+        auto indices = utility::argsort<std::uint32_t>(merge_sort, collection, std::greater<>{});
+        CHECK( is_sorting_permutation(indices, collection, std::greater<>{}) );
+        CHECK( is_stable_permutation(indices, collection) );
+    }
+
+    SECTION( "non-comparison sorter" )
+    {
+        auto indices = utility::argsort<std::uint64_t>(ska_sort, collection);
+        CHECK( is_sorting_permutation(indices, collection) );
+    }
+}
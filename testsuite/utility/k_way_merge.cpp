@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/k_way_merge.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "k-way merge of sorted ranges", "[utility][k_way_merge]" )
+{
+    using namespace cppsort;
+    auto distribution = dist::shuffled{};
+
+    SECTION( "many ranges of different sizes" )
+    {
+        std::vector<std::vector<int>> ranges(100);
+        std::vector<int> expected;
+        for (std::size_t i = 0 ; i < ranges.size() ; ++i) {
+            distribution(std::back_inserter(ranges[i]), 5 + i * 7 % 53, 0);
+            std::sort(ranges[i].begin(), ranges[i].end());
+            expected.insert(expected.end(), ranges[i].begin(), ranges[i].end());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<int> res;
+        utility::k_way_merge(ranges, std::back_inserter(res));
+        CHECK( res == expected );
+    }
+
+    SECTION( "custom comparison and linked lists" )
+    {
+        std::vector<std::list<int>> ranges = {
+            { 9, 7, 7, 3, 0 },
+            { 8, 4, 2 },
+            {},
+            { 10, 7, 1 }
+        };
+
+        std::vector<int> res;
+        utility::k_way_merge(ranges, std::back_inserter(res), std::greater<>{});
+        CHECK( res == std::vector<int>{ 10, 9, 8, 7, 7, 7, 4, 3, 2, 1, 0 } );
+    }
+
+    SECTION( "stability and projection" )
+    {
+        using value_type = std::pair<int, int>;
+        std::vector<std::vector<value_type>> ranges(10);
+        for (int i = 0 ; i < 10 ; ++i) {
+            for (int j = 0 ; j < 50 ; ++j) {
+                // Second member is the index of the range
+                ranges[i].emplace_back(j / (i + 1), i);
+            }
+        }
+
+        std::vector<value_type> res;
+        utility::k_way_merge(ranges, std::back_inserter(res), std::less<>{}, &value_type::first);
+        CHECK( res.size() == 500 );
+        // Equivalent elements are ordered by range index
+        CHECK( std::is_sorted(res.begin(), res.end()) );
+    }
+
+    SECTION( "stability with few ranges" )
+    {
+        // Fewer ranges than the loser tree threshold, merged pairwise
+        using value_type = std::pair<int, int>;
+        for (int size = 2 ; size < 10 ; ++size) {
+            std::vector<std::vector<value_type>> ranges(size);
+            for (int i = 0 ; i < size ; ++i) {
+                for (int j = 0 ; j < 50 ; ++j) {
+                    ranges[i].emplace_back(j / (i + 1), i);
+                }
+            }
+
+            std::vector<value_type> res;
+            utility::k_way_merge(ranges, std::back_inserter(res), std::less<>{}, &value_type::first);
+            CHECK( res.size() == 50u * size );
+            CHECK( std::is_sorted(res.begin(), res.end()) );
+        }
+    }
+
+    SECTION( "non-arithmetic keys" )
+    {
+        // Enough ranges to go through the loser tree, with keys that
+        // are compared through their sources
+        std::vector<std::vector<std::string>> ranges(12);
+        std::vector<std::string> expected;
+        for (std::size_t i = 0 ; i < ranges.size() ; ++i) {
+            // Ranges of different sizes, so that some of them are
+            // exhausted while the others are still merged
+            for (std::size_t j = 0 ; j <= i ; ++j) {
+                ranges[i].push_back(std::string(i % 3 + 1, static_cast<char>('a' + j)));
+            }
+            expected.insert(expected.end(), ranges[i].begin(), ranges[i].end());
+        }
+        std::sort(expected.begin(), expected.end());
+
+        std::vector<std::string> res;
+        utility::k_way_merge(ranges, std::back_inserter(res));
+        CHECK( res == expected );
+    }
+
+    SECTION( "degenerate cases" )
+    {
+        std::vector<std::vector<int>> ranges;
+        std::vector<int> res;
+        utility::k_way_merge(ranges, std::back_inserter(res));
+        CHECK( res.empty() );
+
+        ranges = { {}, { 1, 2, 3 }, {} };
+        auto out = utility::k_way_merge(ranges, std::back_inserter(res));
+        *out = 4;
+        CHECK( res == std::vector<int>{ 1, 2, 3, 4 } );
+    }
+}
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/lazy_sorted_view.h>
+#include <testing-tools/distributions.h>
+
+TEST_CASE( "lazy sorted view", "[utility][lazy_sorted_view]" )
+{
+    using namespace cppsort;
+
+    std::vector<int> collection;
+    collection.reserve(10000);
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), 10000, 0);
+
+    auto expected = collection;
+    std::sort(expected.begin(), expected.end());
+
+    SECTION( "consume the first elements only" )
+    {
+        auto view = utility::make_lazy_sorted_view(collection);
+        CHECK( view.size() == 10000 );
+        CHECK( view.sorted_size() == 0 );
+
+        auto it = view.begin();
+        for (int i = 0 ; i < 100 ; ++i) {
+            CHECK( *it == expected[i] );
+            ++it;
+        }
+        CHECK( view.sorted_size() >= 100 );
+        CHECK( view.sorted_size() < 10000 );
+        CHECK( std::equal(collection.begin(), collection.begin() + 100, expected.begin()) );
+    }
+
+    SECTION( "consume the whole collection" )
+    {
+        auto view = utility::make_lazy_sorted_view(collection.begin(), collection.end());
+        CHECK( std::equal(view.begin(), view.end(), expected.begin(), expected.end()) );
+        CHECK( view.sorted_size() == 10000 );
+        CHECK( collection == expected );
+    }
+
+    SECTION( "random access and moved view" )
+    {
+        auto view = utility::make_lazy_sorted_view(collection, std::greater<>{});
+        auto it = view.begin();
+        CHECK( *it == 9999 );
+
+        auto moved = std::move(view);
+        CHECK( moved[5000] == 4999 );
+        CHECK( *++it == 9998 );
+        CHECK( moved[9999] == 0 );
+    }
+
+    SECTION( "projection and many duplicates" )
+    {
+        struct wrapper { int value; };
+        std::vector<int> values;
+        auto distribution_16 = dist::shuffled_16_values{};
+        distribution_16(std::back_inserter(values), 5000);
+        std::vector<wrapper> vec;
+        for (int value: values) {
+            vec.push_back({ value });
+        }
+
+        auto view = utility::make_lazy_sorted_view(vec, std::less<>{}, &wrapper::value);
+        auto it = view.begin();
+        for (int i = 0 ; i < 2000 ; ++i, ++it) {
+            CHECK( it->value == (*it).value );
+        }
+        CHECK( std::is_sorted(vec.begin(), vec.begin() + 2000, [](wrapper lhs, wrapper rhs) {
+            return lhs.value < rhs.value;
+        }) );
+        for (int i = 2000 ; i < 5000 ; ++i) {
+            CHECK( vec[1999].value <= vec[i].value );
+        }
+    }
+
+    SECTION( "patterns" )
+    {
+        std::vector<int> vec;
+        dist::ascending_sawtooth{}(std::back_inserter(vec), 10000);
+        auto copy = vec;
+        std::sort(copy.begin(), copy.end());
+        auto view = utility::make_lazy_sorted_view(vec);
+        CHECK( std::equal(view.begin(), view.end(), copy.begin(), copy.end()) );
+
+        vec.clear();
+        dist::descending{}(std::back_inserter(vec), 10000);
+        auto view2 = utility::make_lazy_sorted_view(vec);
+        CHECK( view2[0] == 0 );
+        CHECK( view2[9999] == 9999 );
+    }
+
+    SECTION( "empty and tiny collections" )
+    {
+        std::vector<std::string> empty;
+        auto view = utility::make_lazy_sorted_view(empty);
+        CHECK( view.empty() );
+        CHECK( view.begin() == view.end() );
+
+        std::vector<std::string> vec = { "b", "c", "a" };
+        auto view2 = utility::make_lazy_sorted_view(vec);
+        CHECK( std::equal(view2.begin(), view2.end(), std::vector<std::string>{ "a", "b", "c" }.begin()) );
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/utility/segmented_sort.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    template<typename T, typename Compare=std::less<>>
+    auto is_segment_sorted(const std::vector<T>& collection, const std::vector<std::size_t>& offsets,
+                           Compare compare={})
+        -> bool
+    {
+        for (std::size_t i = 1 ; i < offsets.size() ; ++i) {
+            if (not std::is_sorted(collection.begin() + offsets[i - 1],
+                                   collection.begin() + offsets[i],
+                                   compare)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Segments of every size up to max_size, a few times each,
+    // including empty ones
+    auto make_offsets(std::size_t max_size)
+        -> std::vector<std::size_t>
+    {
+        std::vector<std::size_t> offsets = { 0 };
+        for (int times = 0 ; times < 3 ; ++times) {
+            for (std::size_t size = 0 ; size <= max_size ; ++size) {
+                offsets.push_back(offsets.back() + size);
+            }
+        }
+        return offsets;
+    }
+}
+
+TEST_CASE( "segmented_sort", "[utility][segmented_sort]" )
+{
+    auto offsets = make_offsets(300);
+
+    std::vector<int> collection;
+    collection.reserve(offsets.back());
+    auto distribution = dist::shuffled{};
+    distribution(std::back_inserter(collection), offsets.back(), -1568);
+
+    SECTION( "default comparison" )
+    {
+        auto copy = collection;
+        cppsort::utility::segmented_sort(collection, offsets);
+        CHECK( is_segment_sorted(collection, offsets) );
+
+        // Check that the elements did not leave their segment
+        for (std::size_t i = 1 ; i < offsets.size() ; ++i) {
+            std::sort(copy.begin() + offsets[i - 1], copy.begin() + offsets[i]);
+        }
+        CHECK( collection == copy );
+    }
+
+    SECTION( "comparison and projection" )
+    {
+        cppsort::utility::segmented_sort(collection.begin(), offsets.begin(), offsets.end(),
+                                         std::greater<>{});
+        CHECK( is_segment_sorted(collection, offsets, std::greater<>{}) );
+
+        cppsort::utility::segmented_sort(collection, offsets, std::greater<>{}, std::negate<>{});
+        CHECK( is_segment_sorted(collection, offsets) );
+    }
+
+    SECTION( "non-trivial types" )
+    {
+        std::vector<std::string> strings;
+        for (auto value: collection) {
+            strings.push_back(std::to_string(value));
+        }
+        cppsort::utility::segmented_sort(strings, offsets);
+        CHECK( is_segment_sorted(strings, offsets) );
+    }
+
+    SECTION( "offsets not starting at zero" )
+    {
+        std::vector<std::size_t> partial_offsets(offsets.begin() + 10, offsets.end() - 10);
+        auto copy = collection;
+        cppsort::utility::segmented_sort(collection, partial_offsets);
+        CHECK( is_segment_sorted(collection, partial_offsets) );
+        CHECK( std::equal(collection.begin(), collection.begin() + partial_offsets.front(), copy.begin()) );
+        CHECK( std::equal(collection.begin() + partial_offsets.back(), collection.end(),
+                          copy.begin() + partial_offsets.back()) );
+    }
+}
@@ -2,14 +2,19 @@
  * Copyright (c) 2021 Morwenn
  * SPDX-License-Identifier: MIT
  */
+#include <algorithm>
 #include <array>
+#include <cstddef>
+#include <functional>
 #include <iterator>
 #include <numeric>
+#include <utility>
 #include <vector>
 #include <catch2/catch.hpp>
 #include <cpp-sort/fixed/sorting_network_sorter.h>
 #include <cpp-sort/utility/sorting_networks.h>
 #include <testing-tools/distributions.h>
+#include <testing-tools/random.h>
 
 TEST_CASE( "sorting with index pairs", "[utility][sorting_networks]" )
 {
@@ -63,3 +68,117 @@ TEST_CASE( "sorting with index pairs from sorting_network_sorter",
         CHECK( std::is_sorted(vec.begin(), vec.end()) );
     }
 }
+
+TEST_CASE( "sorting with generated sorting networks",
+           "[utility][sorting_networks]" )
+{
+    constexpr auto bitonic_pairs = cppsort::utility::bitonic_network_pairs<48, int>();
+    constexpr auto odd_even_merge_pairs = cppsort::utility::odd_even_merge_network_pairs<12, int>();
+    constexpr auto pairwise_pairs = cppsort::utility::pairwise_network_pairs<64, int>();
+    CHECK( bitonic_pairs.size() == 480 );
+    CHECK( odd_even_merge_pairs.size() == 42 );
+    CHECK( pairwise_pairs.size() == 543 );
+
+    std::vector<int> vec;
+    auto distribution = dist::shuffled{};
+
+    SECTION( "bitonic_network_pairs" )
+    {
+        distribution(std::back_inserter(vec), 48);
+        cppsort::utility::swap_index_pairs(vec.begin(), bitonic_pairs);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "odd_even_merge_network_pairs" )
+    {
+        distribution(std::back_inserter(vec), 12);
+        cppsort::utility::swap_index_pairs_force_unroll(vec.begin(), odd_even_merge_pairs);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+
+    SECTION( "pairwise_network_pairs" )
+    {
+        distribution(std::back_inserter(vec), 64);
+        cppsort::utility::swap_index_pairs(vec.begin(), pairwise_pairs);
+        CHECK( std::is_sorted(vec.begin(), vec.end()) );
+    }
+}
+
+TEST_CASE( "generated sorting networks are ordered by layer",
+           "[utility][sorting_networks]" )
+{
+    // Pairs sharing an index can't be in the same layer, so the
+    // start of each layer is the first pair sharing an index with
+    // a previous pair of the current layer: the number of layers
+    // found that way must be the depth of the network
+    constexpr auto pairs = cppsort::utility::odd_even_merge_network_pairs<64, int>();
+
+    int nb_layers = 1;
+    std::vector<bool> used(64, false);
+    for (auto pair: pairs) {
+        if (used[pair.first] || used[pair.second]) {
+            ++nb_layers;
+            used.assign(64, false);
+        }
+        used[pair.first] = used[pair.second] = true;
+    }
+    CHECK( nb_layers == 21 );
+}
+
+namespace
+{
+    template<std::size_t N>
+    auto check_sorting_network_sorter()
+        -> void
+    {
+        cppsort::sorting_network_sorter<N> sorter;
+        std::vector<int> vec(N);
+
+        // Random permutations, sorted both ways
+        for (int i = 0 ; i < 10 ; ++i) {
+            std::iota(vec.begin(), vec.end(), 0);
+            std::shuffle(vec.begin(), vec.end(), hasard::engine());
+            sorter(vec);
+            CHECK( std::is_sorted(vec.begin(), vec.end()) );
+
+            std::shuffle(vec.begin(), vec.end(), hasard::engine());
+            sorter(vec, std::greater<>{});
+            CHECK( std::is_sorted(vec.begin(), vec.end(), std::greater<>{}) );
+        }
+
+        // Per the 0-1 principle, a comparator network sorts every
+        // input if and only if it sorts every sequence of 0 and 1:
+        // check the descending ones and a bunch of random ones
+        for (std::size_t ones = 0 ; ones <= N ; ++ones) {
+            std::fill(vec.begin(), vec.end(), 0);
+            std::fill_n(vec.begin(), ones, 1);
+            sorter(vec);
+            CHECK( std::is_sorted(vec.begin(), vec.end()) );
+        }
+        for (int i = 0 ; i < 100 ; ++i) {
+            for (auto& value: vec) {
+                value = static_cast<int>(hasard::bit_gen().next_bit());
+            }
+            sorter(vec);
+            CHECK( std::is_sorted(vec.begin(), vec.end()) );
+        }
+    }
+
+    template<std::size_t... Indices>
+    auto check_sorting_network_sorters(std::index_sequence<Indices...>)
+        -> void
+    {
+        // Sizes from 33 to 64
+        int dummy[] = { (check_sorting_network_sorter<33 + Indices>(), 0)... };
+        (void) dummy;
+    }
+}
+
+TEST_CASE( "sorting_network_sorter with more than 32 inputs",
+           "[utility][sorting_networks][sorting_network_sorter]" )
+{
+    check_sorting_network_sorters(std::make_index_sequence<32>{});
+
+    CHECK( cppsort::sorting_network_sorter<48>::index_pairs().size() == 358 );
+    CHECK( cppsort::sorting_network_sorter<64>::index_pairs().size() == 531 );
+}
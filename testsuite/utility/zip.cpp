@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2021 Morwenn
+ * SPDX-License-Identifier: MIT
+ */
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <catch2/catch.hpp>
+#include <cpp-sort/sorters/merge_sorter.h>
+#include <cpp-sort/sorters/pdq_sorter.h>
+#include <cpp-sort/sorters/ska_sorter.h>
+#include <cpp-sort/sorters/tim_sorter.h>
+#include <cpp-sort/utility/iter_move.h>
+#include <cpp-sort/utility/zip.h>
+#include <testing-tools/distributions.h>
+
+namespace
+{
+    struct first_column
+    {
+        template<typename Tuple>
+        auto operator()(Tuple&& tuple) const
+            -> decltype(auto)
+        {
+            return std::get<0>(tuple);
+        }
+    };
+
+    // Check that the columns are still aligned: every value of
+    // the second and third columns is derived from the key it
+    // was stored with
+    auto is_consistent(const std::vector<int>& keys,
+                       const std::vector<long long>& doubled,
+                       const std::vector<std::string>& names)
+        -> bool
+    {
+        for (std::size_t i = 0 ; i < keys.size() ; ++i) {
+            if (doubled[i] / 2 != keys[i] || names[i].substr(0, names[i].find(':')) != std::to_string(keys[i])) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST_CASE( "zip iterator basic operations", "[utility][zip]" )
+{
+    std::vector<int> keys = { 3, 1, 2 };
+    std::vector<std::string> values = { "three", "one", "two" };
+    auto range = cppsort::utility::zip(keys, values);
+
+    CHECK( range.size() == 3 );
+    CHECK( range.end() - range.begin() == 3 );
+    CHECK( std::get<0>(*range.begin()) == 3 );
+    CHECK( std::get<1>(range.begin()[2]) == "two" );
+
+    SECTION( "iter_swap" )
+    {
+        using cppsort::utility::iter_swap;
+        iter_swap(range.begin(), range.begin() + 1);
+        CHECK( keys == std::vector<int>{ 1, 3, 2 } );
+        CHECK( values == std::vector<std::string>{ "one", "three", "two" } );
+    }
+
+    SECTION( "iter_move" )
+    {
+        using cppsort::utility::iter_move;
+        std::tuple<int, std::string> tmp = iter_move(range.begin());
+        *range.begin() = iter_move(range.begin() + 2);
+        *(range.begin() + 2) = std::move(tmp);
+        CHECK( keys == std::vector<int>{ 2, 1, 3 } );
+        CHECK( values == std::vector<std::string>{ "two", "one", "three" } );
+    }
+
+    SECTION( "comparison" )
+    {
+        CHECK( *(range.begin() + 1) < *range.begin() );
+        CHECK( *range.begin() == std::make_tuple(3, std::string("three")) );
+    }
+}
+
+TEST_CASE( "sort parallel collections with zip", "[utility][zip]" )
+{
+    std::vector<int> keys;
+    auto distribution = dist::shuffled_16_values{};
+    distribution(std::back_inserter(keys), 2000);
+
+    std::vector<long long> doubled;
+    std::vector<std::string> names;
+    for (std::size_t i = 0 ; i < keys.size() ; ++i) {
+        doubled.push_back(2ll * keys[i]);
+        names.push_back(std::to_string(keys[i]) + ':' + std::to_string(i));
+    }
+    auto range = cppsort::utility::zip(keys, doubled, names);
+
+    SECTION( "pdq_sorter" )
+    {
+        cppsort::pdq_sort(range);
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        CHECK( is_consistent(keys, doubled, names) );
+        CHECK( std::is_sorted(range.begin(), range.end()) );
+
+        cppsort::pdq_sort(range, std::greater<>{}, first_column{});
+        CHECK( std::is_sorted(keys.begin(), keys.end(), std::greater<>{}) );
+        CHECK( is_consistent(keys, doubled, names) );
+    }
+
+    SECTION( "ska_sorter" )
+    {
+        cppsort::ska_sort(range, first_column{});
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        CHECK( is_consistent(keys, doubled, names) );
+    }
+
+    // Stable sorters: the names record the original position
+    // of the elements, which makes them sorted with the keys
+
+    SECTION( "merge_sorter" )
+    {
+        cppsort::merge_sort(range, first_column{});
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        CHECK( is_consistent(keys, doubled, names) );
+        for (std::size_t i = 1 ; i < keys.size() ; ++i) {
+            if (keys[i - 1] == keys[i]) {
+                CHECK( std::stoi(names[i - 1].substr(names[i - 1].find(':') + 1))
+                     < std::stoi(names[i].substr(names[i].find(':') + 1)) );
+            }
+        }
+    }
+
+    SECTION( "tim_sorter" )
+    {
+        cppsort::tim_sort(range, first_column{});
+        CHECK( std::is_sorted(keys.begin(), keys.end()) );
+        CHECK( is_consistent(keys, doubled, names) );
+        for (std::size_t i = 1 ; i < keys.size() ; ++i) {
+            if (keys[i - 1] == keys[i]) {
+                CHECK( std::stoi(names[i - 1].substr(names[i - 1].find(':') + 1))
+                     < std::stoi(names[i].substr(names[i].find(':') + 1)) );
+            }
+        }
+    }
+}
+
+TEST_CASE( "zip collections of different sizes", "[utility][zip]" )
+{
+    // The range stops at the end of the smallest collection
+
+    std::vector<int> keys = { 5, 3, 8, 1, 9, 2 };
+    std::vector<int> short_column = { 50, 30, 80, 10 };
+    std::vector<int> long_column = { 5, 3, 8, 1, 9, 2, 7, 6 };
+
+    auto range = cppsort::utility::zip(keys, short_column, long_column);
+    CHECK( range.size() == 4 );
+
+    cppsort::pdq_sort(range);
+    CHECK( keys == std::vector<int>({ 1, 3, 5, 8, 9, 2 }) );
+    CHECK( short_column == std::vector<int>({ 10, 30, 50, 80 }) );
+    CHECK( long_column == std::vector<int>({ 1, 3, 5, 8, 9, 2, 7, 6 }) );
+}